@@ -103,8 +103,9 @@ main(int argc, char * argv[])
   SetForwardProjectionFromGgo(args_info, admmFilter.GetPointer());
   SetBackProjectionFromGgo(args_info, admmFilter.GetPointer());
 
-  // Set all four numerical parameters
+  // Set all five numerical parameters
   admmFilter->SetCG_iterations(args_info.CGiter_arg);
+  admmFilter->SetCG_tolerance(args_info.CGtol_arg);
   admmFilter->SetAL_iterations(args_info.niterations_arg);
   admmFilter->SetAlpha(args_info.alpha_arg);
   admmFilter->SetBeta(args_info.beta_arg);
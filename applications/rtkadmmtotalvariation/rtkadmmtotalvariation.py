@@ -36,6 +36,12 @@ def build_parser():
         type=int,
         default=5,
     )
+    parser.add_argument(
+        "--CGtol",
+        help="Relative residual tolerance of conjugate gradient, CGiter is then a maximum",
+        type=float,
+        default=0.0,
+    )
     parser.add_argument("-i", "--input", help="Input volume", type=str)
     parser.add_argument(
         "--nodisplaced",
@@ -151,8 +157,9 @@ def process(args_info: argparse.Namespace):
     rtk.SetForwardProjectionFromArgParse(args_info, admmFilter)
     rtk.SetBackProjectionFromArgParse(args_info, admmFilter)
 
-    # Set all four numerical parameters
+    # Set all five numerical parameters
     admmFilter.SetCG_iterations(args_info.CGiter)
+    admmFilter.SetCG_tolerance(args_info.CGtol)
     admmFilter.SetAL_iterations(args_info.niterations)
     admmFilter.SetAlpha(args_info.alpha)
     admmFilter.SetBeta(args_info.beta)
@@ -0,0 +1,328 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "rtkbenchmark_ggo.h"
+#include "rtkGgoFunctions.h"
+#include "rtkConfiguration.h"
+#include "rtkConstantImageSource.h"
+#include "rtkDrawSheppLoganFilter.h"
+#include "rtkFDKBackProjectionImageFilter.h"
+#include "rtkFFTRampImageFilter.h"
+#include "rtkJosephForwardProjectionImageFilter.h"
+#include "rtkSheppLoganPhantomFilter.h"
+#include "rtkZengForwardProjectionImageFilter.h"
+
+#include <itkMultiThreaderBase.h>
+#include <itkTimeProbe.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using ImageType = itk::Image<float, Dimension>;
+using GeometryType = rtk::ThreeDCircularProjectionGeometry;
+
+// Fixed scanner and phantom dimensions (mm), independent of the sampling
+constexpr double SourceToIsocenterDistance = 1000.;
+constexpr double SourceToDetectorDistance = 1536.;
+constexpr double VolumeExtent = 256.;
+constexpr double DetectorExtent = 600.;
+
+/** One timed update of a filter. The counts are the total number of work items
+ * processed by one update, zero when they are not meaningful for the filter. */
+struct Measurement
+{
+  std::string  Filter;
+  std::string  Geometry;
+  unsigned int Size;
+  unsigned int NumberOfProjections;
+  unsigned int NumberOfThreads;
+  double       Seconds;
+  double       VoxelUpdates;
+  double       Rays;
+};
+
+GeometryType::Pointer
+CreateGeometry(const std::string & name, unsigned int nproj)
+{
+  auto geometry = GeometryType::New();
+  for (unsigned int i = 0; i < nproj; i++)
+  {
+    const double angle = i * 360. / nproj;
+    if (name == "parallel")
+      geometry->AddProjection(SourceToIsocenterDistance, 0., angle);
+    else if (name == "tilted")
+      geometry->AddProjection(SourceToIsocenterDistance, SourceToDetectorDistance, angle, 20., 10., 10., 5.);
+    else
+      geometry->AddProjection(SourceToIsocenterDistance, SourceToDetectorDistance, angle);
+  }
+  if (name == "cylindrical")
+    geometry->SetRadiusCylindricalDetector(SourceToDetectorDistance);
+  return geometry;
+}
+
+/** Centered image of zeros, disconnected from its source so that the timed
+ * updates only execute the benchmarked filter. */
+ImageType::Pointer
+CreateImage(const ImageType::SizeType & size, const ImageType::SpacingType & spacing)
+{
+  ImageType::PointType origin;
+  for (unsigned int i = 0; i < Dimension; i++)
+    origin[i] = -0.5 * (size[i] - 1) * spacing[i];
+
+  auto source = rtk::ConstantImageSource<ImageType>::New();
+  source->SetOrigin(origin);
+  source->SetSpacing(spacing);
+  source->SetSize(size);
+  source->SetConstant(0.);
+  source->Update();
+  ImageType::Pointer image = source->GetOutput();
+  image->DisconnectPipeline();
+  return image;
+}
+
+ImageType::Pointer
+CreateVolume(unsigned int size)
+{
+  auto zeros = CreateImage(itk::MakeSize(size, size, size),
+                           itk::MakeVector(VolumeExtent / size, VolumeExtent / size, VolumeExtent / size));
+
+  using DSLType = rtk::DrawSheppLoganFilter<ImageType, ImageType>;
+  auto                dsl = DSLType::New();
+  DSLType::VectorType scale;
+  scale.Fill(0.5 * VolumeExtent);
+  dsl->SetInput(zeros);
+  dsl->SetPhantomScale(scale);
+  dsl->Update();
+  ImageType::Pointer volume = dsl->GetOutput();
+  volume->DisconnectPipeline();
+  return volume;
+}
+
+/** Analytic projections of the Shepp-Logan phantom. Parallel projections have
+ * the sampling of the volume, as required by the Zeng projector. */
+ImageType::Pointer
+CreateProjections(unsigned int size, const GeometryType * geometry, bool parallel)
+{
+  const double spacing = (parallel ? VolumeExtent : DetectorExtent) / size;
+  auto zeros = CreateImage(itk::MakeSize(size, size, geometry->GetGantryAngles().size()),
+                           itk::MakeVector(spacing, spacing, parallel ? spacing : 1.));
+
+  using SLPType = rtk::SheppLoganPhantomFilter<ImageType, ImageType>;
+  auto                slp = SLPType::New();
+  SLPType::VectorType scale;
+  scale.Fill(0.5 * VolumeExtent);
+  slp->SetInput(zeros);
+  slp->SetGeometry(geometry);
+  slp->SetPhantomScale(scale);
+  slp->Update();
+  ImageType::Pointer projections = slp->GetOutput();
+  projections->DisconnectPipeline();
+  return projections;
+}
+
+/** Fastest of repeat updates of filter, in seconds. */
+double
+TimeUpdate(itk::ProcessObject * filter, unsigned int repeat)
+{
+  itk::TimeProbe probe;
+  for (unsigned int r = 0; r < repeat; r++)
+  {
+    filter->Modified();
+    probe.Start();
+    filter->Update();
+    probe.Stop();
+  }
+  return probe.GetMinimum();
+}
+
+void
+WriteJSON(std::ostream & os, const std::vector<Measurement> & measurements, unsigned int repeat)
+{
+  os << std::setprecision(8);
+  os << "{\n"
+     << "  \"rtk_version\": \"" << RTK_VERSION_STRING << "\",\n"
+     << "  \"repeat\": " << repeat << ",\n"
+     << "  \"results\": [";
+  for (size_t i = 0; i < measurements.size(); i++)
+  {
+    const Measurement & m = measurements[i];
+    os << (i ? ",\n" : "\n") << "    { "
+       << "\"filter\": \"" << m.Filter << "\", "
+       << "\"geometry\": \"" << m.Geometry << "\", "
+       << "\"size\": " << m.Size << ", "
+       << "\"projections\": " << m.NumberOfProjections << ", "
+       << "\"threads\": " << m.NumberOfThreads << ", "
+       << "\"seconds\": " << m.Seconds << ", "
+       << "\"projections_per_second\": " << m.NumberOfProjections / m.Seconds;
+    if (m.VoxelUpdates > 0.)
+      os << ", \"voxel_updates_per_second\": " << m.VoxelUpdates / m.Seconds;
+    if (m.Rays > 0.)
+      os << ", \"rays_per_second\": " << m.Rays / m.Seconds;
+    os << " }";
+  }
+  os << "\n  ]\n}\n";
+}
+
+/** Runs all requested filters for all sizes, geometries and numbers of
+ * threads. The input data are computed once per size and geometry with the
+ * default number of threads. */
+void
+RunBenchmarks(const args_info_rtkbenchmark & args_info, std::vector<Measurement> & measurements)
+{
+  const unsigned int defaultThreads = itk::MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  const unsigned int nproj = args_info.nproj_arg;
+  const unsigned int repeat = std::max(args_info.repeat_arg, 1);
+
+  std::vector<bool> filters(4, args_info.filter_given == 0);
+  for (unsigned int i = 0; i < args_info.filter_given; i++)
+    filters[args_info.filter_arg[i]] = true;
+
+  const char *             geometryNames[] = { "aligned", "tilted", "cylindrical" };
+  std::vector<std::string> geometries;
+  for (unsigned int i = 0; i < std::max(args_info.geometry_given, 1u); i++)
+    geometries.emplace_back(geometryNames[args_info.geometry_arg[i]]);
+
+  // The Zeng projector only handles parallel geometries
+  if (filters[filter_arg_zeng])
+    geometries.emplace_back("parallel");
+
+  // Multiple options store their default value in the first element
+  for (unsigned int s = 0; s < std::max(args_info.size_given, 1u); s++)
+  {
+    const unsigned int size = args_info.size_arg[s];
+    const double       nvox = double(size) * size * size;
+    const double       nrays = double(size) * size * nproj;
+
+    itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(defaultThreads);
+    ImageType::Pointer volume = CreateVolume(size);
+    ImageType::Pointer zeroVolume = CreateImage(volume->GetLargestPossibleRegion().GetSize(), volume->GetSpacing());
+
+    for (const std::string & geometryName : geometries)
+    {
+      const bool parallel = (geometryName == "parallel");
+      if (parallel && !filters[filter_arg_zeng])
+        continue;
+      if (args_info.verbose_flag)
+        std::cout << "Preparing " << geometryName << " data of size " << size << "..." << std::endl;
+
+      itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(defaultThreads);
+      GeometryType::Pointer geometry = CreateGeometry(geometryName, nproj);
+      ImageType::Pointer    projections = CreateProjections(size, geometry, parallel);
+      ImageType::Pointer    zeroProjections =
+        CreateImage(projections->GetLargestPossibleRegion().GetSize(), projections->GetSpacing());
+
+      for (unsigned int t = 0; t < std::max(args_info.threads_given, 1u); t++)
+      {
+        const unsigned int threads = (args_info.threads_arg[t] > 0) ? args_info.threads_arg[t] : defaultThreads;
+        itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(threads);
+
+        Measurement m{ "", geometryName, size, nproj, threads, 0., 0., 0. };
+        if (parallel)
+        {
+          auto zfp = rtk::ZengForwardProjectionImageFilter<ImageType, ImageType>::New();
+          zfp->InPlaceOff();
+          zfp->SetInput(zeroProjections);
+          zfp->SetInput(1, volume);
+          zfp->SetGeometry(geometry);
+          zfp->SetNumberOfWorkUnits(threads);
+          m.Filter = "ZengForwardProjectionImageFilter";
+          m.Seconds = TimeUpdate(zfp, repeat);
+          m.Rays = nrays;
+          measurements.push_back(m);
+        }
+        else
+        {
+          if (filters[filter_arg_joseph])
+          {
+            auto jfp = rtk::JosephForwardProjectionImageFilter<ImageType, ImageType>::New();
+            jfp->InPlaceOff();
+            jfp->SetInput(zeroProjections);
+            jfp->SetInput(1, volume);
+            jfp->SetGeometry(geometry);
+            jfp->SetNumberOfWorkUnits(threads);
+            m.Filter = "JosephForwardProjectionImageFilter";
+            m.Seconds = TimeUpdate(jfp, repeat);
+            m.Rays = nrays;
+            measurements.push_back(m);
+          }
+
+          // The voxel-based FDK backprojector does not handle cylindrical detectors
+          if (filters[filter_arg_fdk] && geometry->GetRadiusCylindricalDetector() == 0.)
+          {
+            auto bp = rtk::FDKBackProjectionImageFilter<ImageType, ImageType>::New();
+            bp->InPlaceOff();
+            bp->SetInput(zeroVolume);
+            bp->SetInput(1, projections);
+            bp->SetGeometry(geometry);
+            bp->SetNumberOfWorkUnits(threads);
+            m.Filter = "FDKBackProjectionImageFilter";
+            m.Seconds = TimeUpdate(bp, repeat);
+            m.VoxelUpdates = nvox * nproj;
+            m.Rays = 0.;
+            measurements.push_back(m);
+          }
+
+          if (filters[filter_arg_ramp])
+          {
+            auto ramp = rtk::FFTRampImageFilter<ImageType, ImageType, double>::New();
+            ramp->SetInput(projections);
+            ramp->SetNumberOfWorkUnits(threads);
+            m.Filter = "FFTRampImageFilter";
+            m.Seconds = TimeUpdate(ramp, repeat);
+            m.VoxelUpdates = 0.;
+            m.Rays = nrays;
+            measurements.push_back(m);
+          }
+        }
+      }
+    }
+  }
+  itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(defaultThreads);
+}
+} // namespace
+
+int
+main(int argc, char * argv[])
+{
+  GGO(rtkbenchmark, args_info);
+
+  std::vector<Measurement> measurements;
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(RunBenchmarks(args_info, measurements))
+
+  if (args_info.verbose_flag)
+  {
+    for (const Measurement & m : measurements)
+      std::cout << m.Filter << " (" << m.Geometry << ", size " << m.Size << ", " << m.NumberOfThreads
+                << " threads): " << m.Seconds << " s" << std::endl;
+  }
+
+  std::ofstream ofs(args_info.output_arg);
+  if (!ofs)
+  {
+    std::cerr << "Could not open " << args_info.output_arg << " for writing" << std::endl;
+    return EXIT_FAILURE;
+  }
+  WriteJSON(ofs, measurements, std::max(args_info.repeat_arg, 1));
+
+  return EXIT_SUCCESS;
+}
@@ -128,6 +128,12 @@ def add_rtkinputprojections_group(parser):
         type=float,
         default=0,
     )
+    rtkinputprojections_group.add_argument(
+        "--readahead",
+        help="Number of projection files prefetched ahead of the one read",
+        type=int,
+        default=8,
+    )
 
 
 # Mimicks GetProjectionsFileNamesFromGgo
@@ -238,6 +244,13 @@ def SetProjectionsReaderFromArgParse(reader, args_info):
     if args_info.wpc is not None:
         reader.SetWaterPrecorrectionCoefficients(args_info.wpc)
 
+    # Prefetching of the files
+    if args_info.readahead < 0:
+        raise RuntimeError(
+            f"Number of read-ahead files must be positive or zero, got {args_info.readahead}"
+        )
+    reader.SetNumberOfReadAheadFiles(args_info.readahead)
+
     # Pass list to projections reader
     reader.SetFileNames(fileNames)
     reader.UpdateOutputInformation()
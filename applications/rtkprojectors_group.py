@@ -57,6 +57,11 @@ def add_rtkprojectors_group(parser):
         "--superiorclipimage",
         help="Superior clip of the ray for each pixel of the projections (Joseph only)",
     )
+    rtkprojectors_group.add_argument(
+        "--raytable",
+        help="Compute the ray intersections once and share them between the Joseph projectors (Joseph only)",
+        action="store_true",
+    )
 
 
 # Mimicks SetBackProjectionFromGgo
@@ -127,3 +132,4 @@ def SetForwardProjectionFromArgParse(args_info, recon):
             recon.SetAlphaPSF(args_info.alphapsf)
         if args_info.attenuationmap is not None:
             recon.SetAttenuationMap(attenuation_map)
+    recon.SetUseJosephRayTable(args_info.raytable)
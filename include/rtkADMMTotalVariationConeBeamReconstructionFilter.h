@@ -123,6 +123,10 @@ namespace rtk
  * }
  * \enddot
  *
+ * R_t p does not change between iterations and is computed only once. The
+ * nested conjugate gradient starts from f_k and may stop before CG_iterations
+ * when its relative residual is below CG_tolerance.
+ *
  * \test rtkadmmtotalvariationtest.cxx
  *
  * \author Cyril Mory
@@ -198,6 +202,12 @@ public:
   itkSetMacro(CG_iterations, float);
   itkGetMacro(CG_iterations, float);
 
+  /** Relative tolerance on the residual of the nested conjugate gradient, see
+   * rtk::ConjugateGradientImageFilter::SetTolerance. CG_iterations is then the
+   * maximum number of nested iterations. 0 (default) disables the test. */
+  itkSetMacro(CG_tolerance, double);
+  itkGetMacro(CG_tolerance, double);
+
   /** Set / Get whether the displaced detector filter should be disabled */
   itkSetMacro(DisableDisplacedDetectorFilter, bool);
   itkGetMacro(DisableDisplacedDetectorFilter, bool);
@@ -259,6 +269,7 @@ private:
   float        m_Beta;
   unsigned int m_AL_iterations;
   unsigned int m_CG_iterations;
+  double       m_CG_tolerance{ 0. };
 
   ThreeDCircularProjectionGeometry::Pointer m_Geometry;
 };
@@ -74,10 +74,13 @@ ADMMTotalVariationConeBeamReconstructionFilter<TOutputImage>::ADMMTotalVariation
   // Set permanent parameters
   m_ZeroMultiplyVolumeFilter->SetConstant2(itk::NumericTraits<typename TOutputImage::PixelType>::ZeroValue());
   m_ZeroMultiplyGradientFilter->SetConstant2(itk::NumericTraits<typename GradientImageType::PixelType>::ZeroValue());
+  m_ConjugateGradientFilter->SetReuseBuffers(true);
   m_DisplacedDetectorFilter->SetPadOnTruncatedSide(false);
   m_DisableDisplacedDetectorFilter = false;
   // Not in place to avoid reading the projections twice
   m_DisplacedDetectorFilter->SetInPlace(false);
+  // Not in place to keep the backprojection of the projections between iterations
+  m_SubtractVolumeFilter->SetInPlace(false);
 
   // Set memory management parameters
   m_ZeroMultiplyVolumeFilter->ReleaseDataFlagOn();
@@ -198,6 +201,7 @@ ADMMTotalVariationConeBeamReconstructionFilter<TOutputImage>::GenerateOutputInfo
 
   // Set runtime parameters
   m_ConjugateGradientFilter->SetNumberOfIterations(this->m_CG_iterations);
+  m_ConjugateGradientFilter->SetTolerance(this->m_CG_tolerance);
 
   // Have the last filter calculate its output information
   m_SubtractFilter2->UpdateOutputInformation();
@@ -210,6 +214,13 @@ template <typename TOutputImage>
 void
 ADMMTotalVariationConeBeamReconstructionFilter<TOutputImage>::GenerateData()
 {
+  // The backprojection of the weighted projections does not depend on the
+  // iteration. Compute it once and take it out of the pipeline.
+  m_BackProjectionFilter->Update();
+  typename TOutputImage::Pointer backProjection = m_BackProjectionFilter->GetOutput();
+  backProjection->DisconnectPipeline();
+  m_SubtractVolumeFilter->SetInput1(backProjection);
+
   itk::IterationReporter iterationReporter(this, 0, 1);
   for (unsigned int iter = 0; iter < m_AL_iterations; iter++)
   {
@@ -153,8 +153,6 @@ AmsterdamShroudImageFilter<TInputImage>::CropOutsideProjectedBox()
   typename TInputImage::RegionType reg;
   reg = m_DerivativeFilter->GetOutput()->GetRequestedRegion();
 
-  typename itk::ImageRegionIterator<TInputImage> it(m_DerivativeFilter->GetOutput(), reg);
-
   // Prepare the 8 corners of the box
   std::vector<GeometryType::HomogeneousVectorType> corners;
   for (unsigned int i = 0; i < 8; i++)
@@ -176,45 +174,53 @@ AmsterdamShroudImageFilter<TInputImage>::CropOutsideProjectedBox()
     corners.push_back(corner);
   }
 
-  for (int iProj = reg.GetIndex(2); iProj < reg.GetIndex(2) + (int)reg.GetSize(2); iProj++)
-  {
-    // Project and keep the inferior and superior 2d corner
-    itk::ContinuousIndex<double, 3> pCornerInf{}, pCornerSup{};
-    for (unsigned int ci = 0; ci < 8; ci++)
-    {
-      typename TInputImage::PointType pCorner(0.);
-      vnl_vector<double> pCornerVnl = m_Geometry->GetMatrices()[iProj].GetVnlMatrix() * corners[ci].GetVnlVector();
-      for (unsigned int i = 0; i < 2; i++)
-        pCorner[i] = pCornerVnl[i] / pCornerVnl[2];
-      const itk::ContinuousIndex<double, 3> pCornerI =
-        this->GetInput()
-          ->template TransformPhysicalPointToContinuousIndex<typename TInputImage::PointType::ValueType, double>(
-            pCorner);
-      if (ci == 0)
+  // Projections are independent and processed in parallel
+  this->GetMultiThreader()->ParallelizeArray(
+    static_cast<itk::SizeValueType>(reg.GetIndex(2)),
+    static_cast<itk::SizeValueType>(reg.GetIndex(2) + reg.GetSize(2)),
+    [&](itk::SizeValueType iProj) {
+      // Project and keep the inferior and superior 2d corner
+      itk::ContinuousIndex<double, 3> pCornerInf{}, pCornerSup{};
+      for (unsigned int ci = 0; ci < 8; ci++)
       {
-        pCornerInf = pCornerI;
-        pCornerSup = pCornerI;
-      }
-      else
-      {
-        for (int i = 0; i < 2; i++)
+        typename TInputImage::PointType pCorner(0.);
+        vnl_vector<double> pCornerVnl = m_Geometry->GetMatrices()[iProj].GetVnlMatrix() * corners[ci].GetVnlVector();
+        for (unsigned int i = 0; i < 2; i++)
+          pCorner[i] = pCornerVnl[i] / pCornerVnl[2];
+        const itk::ContinuousIndex<double, 3> pCornerI =
+          this->GetInput()
+            ->template TransformPhysicalPointToContinuousIndex<typename TInputImage::PointType::ValueType, double>(
+              pCorner);
+        if (ci == 0)
         {
-          pCornerInf[i] = std::min(pCornerInf[i], pCornerI[i]);
-          pCornerSup[i] = std::max(pCornerSup[i], pCornerI[i]);
+          pCornerInf = pCornerI;
+          pCornerSup = pCornerI;
+        }
+        else
+        {
+          for (int i = 0; i < 2; i++)
+          {
+            pCornerInf[i] = std::min(pCornerInf[i], pCornerI[i]);
+            pCornerSup[i] = std::max(pCornerSup[i], pCornerI[i]);
+          }
         }
       }
-    }
 
-    // Set to 0 all pixels outside 2D projected box
-    for (unsigned int j = 0; j < reg.GetSize(1); j++)
-    {
-      for (unsigned int i = 0; i < reg.GetSize(0); i++, ++it)
+      // Set to 0 all pixels outside 2D projected box
+      typename TInputImage::RegionType projReg = reg;
+      projReg.SetIndex(2, iProj);
+      projReg.SetSize(2, 1);
+      itk::ImageRegionIterator<TInputImage> it(m_DerivativeFilter->GetOutput(), projReg);
+      for (unsigned int j = 0; j < reg.GetSize(1); j++)
       {
-        if (i < pCornerInf[0] || i > pCornerSup[0] || j < pCornerInf[1] || j > pCornerSup[1])
-          it.Set(0);
+        for (unsigned int i = 0; i < reg.GetSize(0); i++, ++it)
+        {
+          if (i < pCornerInf[0] || i > pCornerSup[0] || j < pCornerInf[1] || j > pCornerSup[1])
+            it.Set(0);
+        }
       }
-    }
-  }
+    },
+    nullptr);
 }
 
 } // end namespace rtk
@@ -20,8 +20,9 @@
 #define rtkBoellaardScatterCorrectionImageFilter_hxx
 
 
-#include <itkImageRegionConstIterator.h>
-#include <itkImageRegionIterator.h>
+#include <itkImageScanlineIterator.h>
+
+#include <algorithm>
 
 namespace rtk
 {
@@ -60,34 +61,34 @@ BoellaardScatterCorrectionImageFilter<TInputImage, TOutputImage>::ThreadedGenera
   const OutputImageRegionType & outputRegionForThread,
   ThreadIdType                  itkNotUsed(threadId))
 {
-  // Input / ouput iterators
-  itk::ImageRegionConstIterator<InputImageType> itIn(this->GetInput(), outputRegionForThread);
-  itk::ImageRegionIterator<OutputImageType>     itOut(this->GetOutput(), outputRegionForThread);
-
-  const unsigned int Dimension = TInputImage::ImageDimension;
-  unsigned int       npixelPerSlice = 1;
-  for (unsigned int i = 0; i < Dimension - 1; i++)
-    npixelPerSlice *= outputRegionForThread.GetSize(i);
+  const unsigned int    Dimension = TInputImage::ImageDimension;
+  const unsigned int    lineLength = outputRegionForThread.GetSize(0);
+  OutputImageRegionType sliceRegion = outputRegionForThread;
+  sliceRegion.SetSize(Dimension - 1, 1);
 
   unsigned int start = outputRegionForThread.GetIndex(Dimension - 1);
   unsigned int stop = start + outputRegionForThread.GetSize(Dimension - 1);
   for (unsigned int slice = start; slice < stop; slice++)
   {
-    itk::ImageRegionConstIterator<InputImageType> itInSlice = itIn;
+    sliceRegion.SetIndex(Dimension - 1, slice);
+    itk::ImageScanlineConstIterator<InputImageType> itIn(this->GetInput(), sliceRegion);
+    itk::ImageScanlineIterator<OutputImageType>     itOut(this->GetOutput(), sliceRegion);
 
-    // Retrieve useful characteristics of current slice
+    // Retrieve useful characteristics of current slice, line by line on the
+    // buffer so that the reductions can be vectorized
     double averageBehindPatient = 0.;
     double smallestValue = itk::NumericTraits<double>::max();
-    for (unsigned int i = 0; i < npixelPerSlice; i++)
+    for (; !itIn.IsAtEnd(); itIn.NextLine())
     {
-      smallestValue = std::min(smallestValue, (double)itInSlice.Get());
-      if (itInSlice.Get() <= m_AirThreshold)
+      const typename InputImageType::PixelType * in = &(itIn.Value());
+      for (unsigned int i = 0; i < lineLength; i++)
       {
-        averageBehindPatient += itInSlice.Get();
+        const double value = in[i];
+        smallestValue = std::min(smallestValue, value);
+        averageBehindPatient += (in[i] <= m_AirThreshold) ? value : 0.;
       }
-      ++itInSlice;
     }
-    averageBehindPatient /= npixelPerSlice;
+    averageBehindPatient /= sliceRegion.GetNumberOfPixels();
 
     // Compute constant correction
     double correction = averageBehindPatient * m_ScatterToPrimaryRatio;
@@ -97,11 +98,12 @@ BoellaardScatterCorrectionImageFilter<TInputImage, TOutputImage>::ThreadedGenera
       correction = smallestValue - m_NonNegativityConstraintThreshold;
 
     // Remove constant factor
-    for (unsigned int i = 0; i < npixelPerSlice; i++)
+    for (itIn.GoToBegin(); !itIn.IsAtEnd(); itIn.NextLine(), itOut.NextLine())
     {
-      itOut.Set(itIn.Get() - correction);
-      ++itIn;
-      ++itOut;
+      const typename InputImageType::PixelType * in = &(itIn.Value());
+      typename OutputImageType::PixelType *      out = &(itOut.Value());
+      for (unsigned int i = 0; i < lineLength; i++)
+        out[i] = in[i] - correction;
     }
   }
 }
@@ -77,6 +77,23 @@ public:
                      ScalarType &       infDist,
                      ScalarType &       supDist) const override;
 
+  /** See rtk::ConvexShape::AreInside. */
+  void
+  AreInside(const PointType * points, unsigned int n, bool * inside) const override;
+
+  /** See rtk::ConvexShape::AreIntersectedByRays. */
+  void
+  AreIntersectedByRays(const PointType *  rayOrigins,
+                       const VectorType * rayDirections,
+                       unsigned int       n,
+                       ScalarType *       infDist,
+                       ScalarType *       supDist,
+                       bool *             intersected) const override;
+
+  /** Axis-aligned box containing the rotated box. */
+  bool
+  GetBoundingBox(PointType & inf, PointType & sup) const override;
+
   /** Rescale object along each direction by a 3D vector. */
   void
   Rescale(const VectorType & r) override;
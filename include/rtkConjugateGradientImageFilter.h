@@ -66,6 +66,18 @@ public:
   itkGetMacro(NumberOfIterations, int);
   itkSetMacro(NumberOfIterations, int);
 
+  /** Relative tolerance on the residual. The iterations stop before
+   * NumberOfIterations when the norm of B-AX is below Tolerance times its
+   * initial value. The default, 0, always runs NumberOfIterations. */
+  itkGetMacro(Tolerance, double);
+  itkSetMacro(Tolerance, double);
+
+  /** Keep the residual and search direction images allocated after the update
+   * for the next one. Off by default to release the memory. */
+  itkGetMacro(ReuseBuffers, bool);
+  itkSetMacro(ReuseBuffers, bool);
+  itkBooleanMacro(ReuseBuffers);
+
   void
   SetA(ConjugateGradientOperatorType * _arg);
 
@@ -98,7 +110,14 @@ protected:
 
   ConjugateGradientOperatorType * m_A;
 
-  int m_NumberOfIterations;
+  int    m_NumberOfIterations;
+  double m_Tolerance{ 0. };
+  bool   m_ReuseBuffers{ false };
+
+  /** Residual and search direction, kept allocated between updates if
+   * m_ReuseBuffers is on. */
+  OutputImagePointer m_Pk;
+  OutputImagePointer m_Rk;
 };
 } // namespace rtk
 
@@ -110,14 +110,19 @@ ConjugateGradientImageFilter<OutputImageType>::GenerateData()
   typename OutputImageType::RegionType largest = this->GetOutput()->GetLargestPossibleRegion();
   using DataType = typename itk::PixelTraits<typename OutputImageType::PixelType>::ValueType;
 
-  // Create and allocate images
-  auto Pk = OutputImageType::New();
-  auto Rk = OutputImageType::New();
-  Pk->SetRegions(largest);
-  Rk->SetRegions(largest);
+  // Create and allocate images, reusing those of the previous update if possible
+  if (m_Pk.IsNull() || m_Pk->GetBufferedRegion() != largest)
+  {
+    m_Pk = OutputImageType::New();
+    m_Rk = OutputImageType::New();
+    m_Pk->SetRegions(largest);
+    m_Rk->SetRegions(largest);
+    m_Pk->Allocate();
+    m_Rk->Allocate();
+  }
+  OutputImagePointer Pk = m_Pk;
+  OutputImagePointer Rk = m_Rk;
   this->GetOutput()->SetRegions(largest);
-  Pk->Allocate();
-  Rk->Allocate();
   this->GetOutput()->Allocate();
   Pk->CopyInformation(this->GetOutput());
   Rk->CopyInformation(this->GetOutput());
@@ -162,6 +167,7 @@ ConjugateGradientImageFilter<OutputImageType>::GenerateData()
 
   itk::IterationReporter iterationReporter(this, 0, 1);
   bool                   stopIterations = false;
+  DataType               initialResidualNorm2 = 0;
   for (int iter = 0; (iter < m_NumberOfIterations) && !stopIterations; iter++)
   {
     // Compute A * Pk
@@ -195,6 +201,8 @@ ConjugateGradientImageFilter<OutputImageType>::GenerateData()
       },
       nullptr);
     alpha = numerator / (denominator + eps);
+    if (iter == 0)
+      initialResidualNorm2 = numerator;
 
     // Compute Xk+1
     mt->template ParallelizeImageRegion<OutputImageType::ImageDimension>(
@@ -234,6 +242,8 @@ ConjugateGradientImageFilter<OutputImageType>::GenerateData()
       },
       nullptr);
     beta = numerator / (denominator + eps);
+    if (numerator <= m_Tolerance * m_Tolerance * initialResidualNorm2)
+      stopIterations = true;
 
     mt->template ParallelizeImageRegion<OutputImageType::ImageDimension>(
       largest,
@@ -255,6 +265,11 @@ ConjugateGradientImageFilter<OutputImageType>::GenerateData()
     iterationReporter.CompletedStep();
   }
   m_A->GetOutput()->ReleaseData();
+  if (!m_ReuseBuffers)
+  {
+    m_Pk = nullptr;
+    m_Rk = nullptr;
+  }
 }
 } // namespace rtk
 
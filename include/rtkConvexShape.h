@@ -80,6 +80,28 @@ public:
                      ScalarType &       infDist,
                      ScalarType &       supDist) const;
 
+  /** Batch version of IsInside for n points. The default implementation calls
+   * IsInside for each point, derived classes reimplement it with loops over
+   * the points which the compiler can vectorize. */
+  virtual void
+  AreInside(const PointType * points, unsigned int n, bool * inside) const;
+
+  /** Batch version of IsIntersectedByRay for n rays. infDist and supDist are
+   * only meaningful for the rays for which intersected is true. */
+  virtual void
+  AreIntersectedByRays(const PointType *  rayOrigins,
+                       const VectorType * rayDirections,
+                       unsigned int       n,
+                       ScalarType *       infDist,
+                       ScalarType *       supDist,
+                       bool *             intersected) const;
+
+  /** Computes an axis-aligned box containing the object. Returns false if the
+   * object is unbounded or if its bounds are not known, in which case inf and
+   * sup are left unchanged. Clip planes are not accounted for. */
+  virtual bool
+  GetBoundingBox(PointType & inf, PointType & sup) const;
+
   /** Rescale object along each direction by a 3D vector. */
   virtual void
   Rescale(const VectorType & r);
@@ -117,6 +139,18 @@ protected:
                   ScalarType &       supDist) const;
   bool
   ApplyClipPlanes(const PointType & point) const;
+
+  /** Batch versions of ApplyClipPlanes, the points or rays for which inside
+   * or intersected is false on input are skipped. */
+  void
+  ApplyClipPlanes(const PointType *  rayOrigins,
+                  const VectorType * rayDirections,
+                  unsigned int       n,
+                  ScalarType *       infDist,
+                  ScalarType *       supDist,
+                  bool *             intersected) const;
+  void
+  ApplyClipPlanes(const PointType * points, unsigned int n, bool * inside) const;
   itk::LightObject::Pointer
   InternalClone() const override;
 
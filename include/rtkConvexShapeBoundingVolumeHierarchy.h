@@ -0,0 +1,110 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkConvexShapeBoundingVolumeHierarchy_h
+#define rtkConvexShapeBoundingVolumeHierarchy_h
+
+#include "RTKExport.h"
+#include "rtkConvexShape.h"
+
+#include <vector>
+
+namespace rtk
+{
+/** \class ConvexShapeBoundingVolumeHierarchy
+ * \brief Bounding volume hierarchy of a set of ConvexShape.
+ *
+ * The axis-aligned bounding boxes given by ConvexShape::GetBoundingBox are
+ * organized in a binary tree built by median split along the largest extent
+ * of the box centers. It is used to select the shapes which may be
+ * intersected by a line or which may overlap a box without testing all of
+ * them. Unbounded shapes are always selected. The selected shapes are
+ * returned as indices in the vector of shapes, in increasing order, so that
+ * the contributions of the shapes can be accumulated in the same order as the
+ * vector.
+ *
+ * \author Simon Rit
+ *
+ * \ingroup RTK
+ */
+class RTK_EXPORT ConvexShapeBoundingVolumeHierarchy
+{
+public:
+  /** Convenient type alias. */
+  static constexpr unsigned int Dimension = ConvexShape::Dimension;
+  using ConvexShapePointer = ConvexShape::Pointer;
+  using ConvexShapeVector = std::vector<ConvexShapePointer>;
+  using PointType = ConvexShape::PointType;
+  using VectorType = ConvexShape::VectorType;
+  using IndexVectorType = std::vector<unsigned int>;
+
+  /** Set the shapes and build the hierarchy. */
+  void
+  SetConvexShapes(const ConvexShapeVector & shapes);
+  const ConvexShapeVector &
+  GetConvexShapes() const
+  {
+    return m_ConvexShapes;
+  }
+
+  /** Indices of the shapes whose bounding box is intersected by the line
+   * origin + t * direction, t being any real value. */
+  void
+  FindShapesAlongLine(const PointType & origin, const VectorType & direction, IndexVectorType & indices) const;
+
+  /** Indices of the shapes whose bounding box overlaps the box [inf, sup]. */
+  void
+  FindShapesInBox(const PointType & inf, const PointType & sup, IndexVectorType & indices) const;
+
+private:
+  /** A node is a leaf if Count is not 0, in which case it holds the shapes
+   * m_Bounded[First] to m_Bounded[First+Count-1]. Otherwise, its children are
+   * the next node and node Right. */
+  struct Node
+  {
+    PointType    Inf;
+    PointType    Sup;
+    unsigned int First;
+    unsigned int Count;
+    unsigned int Right;
+  };
+
+  unsigned int
+  Build(unsigned int first, unsigned int last);
+
+  static bool
+  IsLineIntersectingBox(const PointType &  origin,
+                        const VectorType & direction,
+                        const PointType &  inf,
+                        const PointType &  sup);
+
+  template <class TPredicate>
+  void
+  Find(const TPredicate & isNodeSelected, IndexVectorType & indices) const;
+
+  ConvexShapeVector      m_ConvexShapes;
+  std::vector<PointType> m_ShapeInf;
+  std::vector<PointType> m_ShapeSup;
+  IndexVectorType        m_Bounded;
+  IndexVectorType        m_Unbounded;
+  std::vector<Node>      m_Nodes;
+};
+
+} // end namespace rtk
+
+#endif
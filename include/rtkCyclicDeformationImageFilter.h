@@ -76,9 +76,12 @@ public:
   SetSignalVector(std::vector<double> _arg);
 
   /** Get / Set the frame number. The number is used to lookup in the signal file
-   * which phase value should be used to interpolate. */
+   * which phase value should be used to interpolate. The filter is not modified
+   * if the new frame has the same signal value as the current one, so that the
+   * 3D DVF is not recomputed for successive frames in the same phase. */
   itkGetMacro(Frame, unsigned int);
-  itkSetMacro(Frame, unsigned int);
+  virtual void
+  SetFrame(const unsigned int _arg);
 
 protected:
   CyclicDeformationImageFilter() = default;
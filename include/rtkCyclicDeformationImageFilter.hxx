@@ -139,6 +139,22 @@ CyclicDeformationImageFilter<TInputImage, TOutputImage>::SetSignalFilename(const
   }
 }
 
+template <class TInputImage, class TOutputImage>
+void
+CyclicDeformationImageFilter<TInputImage, TOutputImage>::SetFrame(const unsigned int _arg)
+{
+  itkDebugMacro("setting Frame to " << _arg);
+  if (this->m_Frame == _arg)
+    return;
+
+  // The output only depends on the signal value of the frame
+  const bool sameSignalValue =
+    this->m_Frame < m_Signal.size() && _arg < m_Signal.size() && m_Signal[this->m_Frame] == m_Signal[_arg];
+  this->m_Frame = _arg;
+  if (!sameSignalValue)
+    this->Modified();
+}
+
 template <class TInputImage, class TOutputImage>
 void
 CyclicDeformationImageFilter<TInputImage, TOutputImage>::SetSignalVector(std::vector<double> _arg)
@@ -22,6 +22,8 @@
 
 #include <itkArray.h>
 
+#include <algorithm>
+
 namespace rtk
 {
 
@@ -91,6 +93,7 @@ DPExtractShroudSignalImageFilter<TInputPixel, TOutputPixel>::GenerateData()
   from->CopyInformation(input);
   from->SetRegions(input->GetLargestPossibleRegion());
   from->Allocate();
+  from->FillBuffer(0);
   int amplitudeInVoxel = m_Amplitude / input->GetSpacing()[0];
 
   auto * prev = new itk::Array<double>(inputSize[0]);
@@ -103,28 +106,39 @@ DPExtractShroudSignalImageFilter<TInputPixel, TOutputPixel>::GenerateData()
     idx[0]++;
   }
 
+  // Each position of a row keeps the best of the positions of the previous row
+  // within the amplitude. Positions are independent and processed in parallel.
+  const TInputPixel * inputRow = input->GetBufferPointer();
+  int *               fromRow = from->GetBufferPointer();
+  const int           width = inputSize[0];
   for (unsigned i = 1; i < inputSize[1]; ++i)
   {
-    (*curr).Fill(0.0);
-    idx[0] = inputIdx[0];
-    for (unsigned j = 0; j < inputSize[0]; ++j)
-    {
-      for (int r = -amplitudeInVoxel; r <= amplitudeInVoxel; ++r)
-      {
-        typename TInputImage::RegionType::IndexType idx_to = idx;
-        idx_to[0] += r;
-        idx_to[1]++;
-        if (input->GetLargestPossibleRegion().IsInside(idx_to) && (*input)[idx_to] + (*prev)[j] > (*curr)[j + r])
+    inputRow += width;
+    fromRow += width;
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      width,
+      [&](itk::SizeValueType jj) {
+        // Same tie-breaking as the exploration of the previous positions in
+        // increasing order
+        const int j = static_cast<int>(jj);
+        double    best = 0.;
+        const int pmin = std::max(j - amplitudeInVoxel, 0);
+        const int pmax = std::min(j + amplitudeInVoxel, width - 1);
+        for (int p = pmin; p <= pmax; ++p)
         {
-          (*curr)[j + r] = (*input)[idx_to] + (*prev)[j];
-          (*from)[idx_to] = -r;
+          if (inputRow[j] + (*prev)[p] > best)
+          {
+            best = inputRow[j] + (*prev)[p];
+            fromRow[j] = p - j;
+          }
         }
-      }
-      idx[0]++;
-    }
-    idx[1]++;
+        (*curr)[j] = best;
+      },
+      nullptr);
     std::swap(prev, curr);
   }
+  idx[1] = inputIdx[1] + inputSize[1] - 1;
 
   unsigned max = 0;
   for (unsigned j = 1; j < inputSize[0]; ++j)
@@ -19,6 +19,7 @@
 #ifndef rtkDrawGeometricPhantomImageFilter_h
 #define rtkDrawGeometricPhantomImageFilter_h
 
+#include "rtkConvexShapeBoundingVolumeHierarchy.h"
 #include "rtkGeometricPhantom.h"
 #include <itkAddImageFilter.h>
 #include <itkInPlaceImageFilter.h>
@@ -29,6 +30,13 @@ namespace rtk
 /** \class DrawGeometricPhantomImageFilter
  * \brief Draws a GeometricPhantom in a 3D image
  *
+ * All shapes are drawn in a single pass over the volume. The volume is
+ * processed by tiles and each voxel of a tile is only tested against the
+ * shapes whose bounding box, given by a ConvexShapeBoundingVolumeHierarchy,
+ * overlaps the tile, one row of the tile at a time with
+ * ConvexShape::AreInside. The densities are added in the order of the
+ * phantom, as DrawConvexImageFilter would do shape by shape.
+ *
  * \test rtkprojectgeometricphantomtest.cxx, rtkforbildtest.cxx
  *
  * \author Marc Vila, Simon Rit
@@ -53,6 +61,7 @@ public:
   using VectorType = ConvexShape::VectorType;
   using RotationMatrixType = ConvexShape::RotationMatrixType;
   using ScalarType = ConvexShape::ScalarType;
+  using OutputImageRegionType = typename TOutputImage::RegionType;
 
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
@@ -99,8 +108,12 @@ protected:
   DrawGeometricPhantomImageFilter();
   ~DrawGeometricPhantomImageFilter() override = default;
 
+  /** Reads the phantom and builds the hierarchy of its transformed shapes. */
+  void
+  BeforeThreadedGenerateData() override;
+
   void
-  GenerateData() override;
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
   GeometricPhantomConstPointer m_GeometricPhantom;
@@ -110,6 +123,8 @@ private:
   RotationMatrixType           m_RotationMatrix;
   std::vector<VectorType>      m_PlaneDirections;
   std::vector<ScalarType>      m_PlanePositions;
+
+  ConvexShapeBoundingVolumeHierarchy m_Hierarchy;
 };
 
 } // end namespace rtk
@@ -20,8 +20,11 @@
 #define rtkDrawGeometricPhantomImageFilter_hxx
 
 #include "rtkForbildPhantomFileReader.h"
-#include "rtkDrawConvexImageFilter.h"
 
+#include <itkImageRegionConstIterator.h>
+#include <itkImageRegionIteratorWithIndex.h>
+
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -38,7 +41,7 @@ DrawGeometricPhantomImageFilter<TInputImage, TOutputImage>::DrawGeometricPhantom
 
 template <class TInputImage, class TOutputImage>
 void
-DrawGeometricPhantomImageFilter<TInputImage, TOutputImage>::GenerateData()
+DrawGeometricPhantomImageFilter<TInputImage, TOutputImage>::BeforeThreadedGenerateData()
 {
   // Reading figure config file
   if (!m_ConfigFile.empty())
@@ -54,8 +57,8 @@ DrawGeometricPhantomImageFilter<TInputImage, TOutputImage>::GenerateData()
   if (cov.empty())
     itkExceptionMacro(<< "Empty phantom");
 
-  // Create one add filter per convex object
-  std::vector<typename itk::ImageSource<TOutputImage>::Pointer> drawers;
+  // Transform a copy of each convex object and build their hierarchy
+  GeometricPhantom::ConvexShapeVector shapes;
   for (const auto & convexShape : cov)
   {
     ConvexShape::Pointer co = convexShape->Clone();
@@ -64,28 +67,98 @@ DrawGeometricPhantomImageFilter<TInputImage, TOutputImage>::GenerateData()
     co->Rescale(m_PhantomScale);
     for (size_t i = 0; i < m_PlaneDirections.size(); i++)
       co->AddClipPlane(m_PlaneDirections[i], m_PlanePositions[i]);
+    shapes.push_back(co);
+  }
+  m_Hierarchy.SetConvexShapes(shapes);
+}
+
+template <class TInputImage, class TOutputImage>
+void
+DrawGeometricPhantomImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  constexpr unsigned int       Dimension = TOutputImage::ImageDimension;
+  constexpr itk::SizeValueType tileSize = 16;
+  const TInputImage *          input = this->GetInput();
+  const auto &                 shapes = m_Hierarchy.GetConvexShapes();
+
+  // Number of tiles along each direction of the region
+  typename OutputImageRegionType::SizeType numberOfTiles;
+  itk::SizeValueType                       totalNumberOfTiles = 1;
+  for (unsigned int i = 0; i < Dimension; i++)
+  {
+    numberOfTiles[i] = (outputRegionForThread.GetSize(i) + tileSize - 1) / tileSize;
+    totalNumberOfTiles *= numberOfTiles[i];
+  }
 
-    if (!drawers.empty())
+  ConvexShapeBoundingVolumeHierarchy::IndexVectorType candidates;
+  typename TOutputImage::PointType                    point;
+  ConvexShape::PointType                              points[tileSize];
+  typename TOutputImage::PixelType                    values[tileSize];
+  bool                                                inside[tileSize];
+  for (itk::SizeValueType t = 0; t < totalNumberOfTiles; t++)
+  {
+    OutputImageRegionType tile;
+    itk::SizeValueType    rem = t;
+    for (unsigned int i = 0; i < Dimension; i++)
     {
-      using RCOIType = DrawConvexImageFilter<TOutputImage, TOutputImage>;
-      auto rcoi = RCOIType::New();
-      rcoi->SetInput(drawers.back()->GetOutput());
-      rcoi->SetConvexShape(co);
-      drawers.push_back(rcoi.GetPointer());
+      const itk::SizeValueType ti = rem % numberOfTiles[i];
+      rem /= numberOfTiles[i];
+      tile.SetIndex(i, outputRegionForThread.GetIndex(i) + static_cast<itk::IndexValueType>(ti * tileSize));
+      tile.SetSize(i, std::min(tileSize, outputRegionForThread.GetSize(i) - ti * tileSize));
     }
-    else
+
+    // Physical bounds of the tile from its corners
+    ConvexShape::PointType tileInf, tileSup;
+    tileInf.Fill(itk::NumericTraits<ScalarType>::max());
+    tileSup.Fill(itk::NumericTraits<ScalarType>::NonpositiveMin());
+    for (unsigned int c = 0; c < (1u << Dimension); c++)
     {
-      using RCOIType = DrawConvexImageFilter<TInputImage, TOutputImage>;
-      auto rcoi = RCOIType::New();
-      rcoi->SetInput(this->GetInput());
-      rcoi->SetConvexShape(co);
-      drawers.push_back(rcoi.GetPointer());
+      typename OutputImageRegionType::IndexType corner = tile.GetIndex();
+      for (unsigned int i = 0; i < Dimension; i++)
+        if ((c >> i) & 1)
+          corner[i] += tile.GetSize(i) - 1;
+      input->TransformIndexToPhysicalPoint(corner, point);
+      for (unsigned int i = 0; i < Dimension; i++)
+      {
+        tileInf[i] = std::min(tileInf[i], static_cast<ScalarType>(point[i]));
+        tileSup[i] = std::max(tileSup[i], static_cast<ScalarType>(point[i]));
+      }
     }
-  }
+    m_Hierarchy.FindShapesInBox(tileInf, tileSup, candidates);
 
-  drawers.back()->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
-  drawers.back()->Update();
-  this->GraftOutput(drawers.back()->GetOutput());
+    // Add the density of the candidate shapes containing each voxel, one row
+    // of the tile at a time
+    itk::ImageRegionConstIterator<TInputImage>      itIn(input, tile);
+    itk::ImageRegionIteratorWithIndex<TOutputImage> itOut(this->GetOutput(), tile);
+    const auto                                      rowSize = static_cast<unsigned int>(tile.GetSize(0));
+    while (!itOut.IsAtEnd())
+    {
+      for (unsigned int k = 0; k < rowSize; k++, ++itIn)
+      {
+        values[k] = static_cast<typename TOutputImage::PixelType>(itIn.Get());
+        if (!candidates.empty())
+        {
+          typename OutputImageRegionType::IndexType idx = itOut.GetIndex();
+          idx[0] += k;
+          input->TransformIndexToPhysicalPoint(idx, point);
+          points[k] = ConvexShape::PointType(&(point[0]));
+        }
+      }
+
+      for (const unsigned int s : candidates)
+      {
+        shapes[s]->AreInside(points, rowSize, inside);
+        const ScalarType density = shapes[s]->GetDensity();
+        for (unsigned int k = 0; k < rowSize; k++)
+          if (inside[k])
+            values[k] += density;
+      }
+
+      for (unsigned int k = 0; k < rowSize; k++, ++itOut)
+        itOut.Set(values[k]);
+    }
+  }
 }
 
 template <class TInputImage, class TOutputImage>
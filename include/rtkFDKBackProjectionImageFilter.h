@@ -58,6 +58,15 @@ public:
   /** Run-time type information (and related methods). */
   itkOverrideGetNameOfClassMacro(FDKBackProjectionImageFilter);
 
+  /** Use float instead of double for the projection coordinates in the
+   * innermost loop of the optimized backprojections. The projection matrix and
+   * the coordinates of the first voxel of each row are still computed in
+   * double. The error on the projection coordinates grows with the length of
+   * the rows since they are accumulated along them. Default is off. */
+  itkGetMacro(SinglePrecisionCoordinates, bool);
+  itkSetMacro(SinglePrecisionCoordinates, bool);
+  itkBooleanMacro(SinglePrecisionCoordinates);
+
 protected:
   FDKBackProjectionImageFilter() = default;
   ~FDKBackProjectionImageFilter() override = default;
@@ -81,6 +90,22 @@ protected:
   OptimizedBackprojectionY(const OutputImageRegionType & region,
                            const ProjectionMatrixType &  matrix,
                            ProjectionImagePointer        projection) override;
+
+private:
+  /** Implementations of the optimized backprojections with TCoordinate
+   * projection coordinates in the innermost loop. */
+  template <class TCoordinate>
+  void
+  BackprojectAlongX(const OutputImageRegionType & region,
+                    const ProjectionMatrixType &  matrix,
+                    ProjectionImagePointer        projection);
+  template <class TCoordinate>
+  void
+  BackprojectAlongY(const OutputImageRegionType & region,
+                    const ProjectionMatrixType &  matrix,
+                    ProjectionImagePointer        projection);
+
+  bool m_SinglePrecisionCoordinates{ false };
 };
 
 } // end namespace rtk
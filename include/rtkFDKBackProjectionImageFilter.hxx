@@ -153,6 +153,32 @@ FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojection
   const OutputImageRegionType & region,
   const ProjectionMatrixType &  matrix,
   const ProjectionImagePointer  projection)
+{
+  if (m_SinglePrecisionCoordinates)
+    BackprojectAlongX<float>(region, matrix, projection);
+  else
+    BackprojectAlongX<double>(region, matrix, projection);
+}
+
+template <class TInputImage, class TOutputImage>
+void
+FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojectionY(
+  const OutputImageRegionType & region,
+  const ProjectionMatrixType &  matrix,
+  const ProjectionImagePointer  projection)
+{
+  if (m_SinglePrecisionCoordinates)
+    BackprojectAlongY<float>(region, matrix, projection);
+  else
+    BackprojectAlongY<double>(region, matrix, projection);
+}
+
+template <class TInputImage, class TOutputImage>
+template <class TCoordinate>
+void
+FDKBackProjectionImageFilter<TInputImage, TOutputImage>::BackprojectAlongX(const OutputImageRegionType & region,
+                                                                        const ProjectionMatrixType &  matrix,
+                                                                        const ProjectionImagePointer  projection)
 {
   typename ProjectionImageType::SizeType  pSize = projection->GetBufferedRegion().GetSize();
   typename ProjectionImageType::IndexType pIndex = projection->GetBufferedRegion().GetIndex();
@@ -165,34 +191,35 @@ FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojection
   pVolZeroPointer = this->GetOutput()->GetBufferPointer();
   pVolZeroPointer -= vBufferIndex[0] + vBufferSize[0] * (vBufferIndex[1] + vBufferSize[1] * vBufferIndex[2]);
 
-  // Continuous index at which we interpolate
-  double u = NAN, v = NAN, w = NAN;
-  int    ui = 0, vi = 0;
-  double du = NAN;
+  // Continuous index at which we interpolate, in TCoordinate in the innermost
+  // loop and in double for the first voxel of each row
+  double      u0 = NAN, v = NAN, w0 = NAN;
+  TCoordinate u = NAN, w = NAN, du = NAN;
+  int         ui = 0, vi = 0;
 
   for (int k = region.GetIndex(2); k < region.GetIndex(2) + (int)region.GetSize(2); k++)
   {
     for (int j = region.GetIndex(1); j < region.GetIndex(1) + (int)region.GetSize(1); j++)
     {
       int i = region.GetIndex(0);
-      u = matrix[0][0] * i + matrix[0][1] * j + matrix[0][2] * k + matrix[0][3];
+      u0 = matrix[0][0] * i + matrix[0][1] * j + matrix[0][2] * k + matrix[0][3];
       v = matrix[1][1] * j + matrix[1][2] * k + matrix[1][3];
-      w = matrix[2][1] * j + matrix[2][2] * k + matrix[2][3];
+      w0 = matrix[2][1] * j + matrix[2][2] * k + matrix[2][3];
 
       // Apply perspective
-      w = 1 / w;
-      u = u * w - pIndex[0];
-      v = v * w - pIndex[1];
-      du = w * matrix[0][0];
-      w *= w;
+      w0 = 1 / w0;
+      u = u0 * w0 - pIndex[0];
+      v = v * w0 - pIndex[1];
+      du = w0 * matrix[0][0];
+      w = w0 * w0;
 
 #ifdef BILINEAR_BACKPROJECTION
-      double u1 = NAN, u2 = NAN, v1 = NAN, v2 = NAN;
+      TCoordinate u1 = NAN, u2 = NAN, v1 = NAN, v2 = NAN;
       vi = itk::Math::floor(v);
       if (vi >= 0 && vi < (int)pSize[1] - 1)
       {
         v1 = v - vi;
-        v2 = 1.0 - v1;
+        v2 = 1 - v1;
 #else
       vi = itk::Math::Round<double>(v) - pIndex[1];
       if (vi >= 0 && vi < (int)pSize[1])
@@ -210,12 +237,12 @@ FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojection
           if (ui >= 0 && ui < (int)pSize[0] - 1)
           {
             u1 = u - ui;
-            u2 = 1.0 - u1;
+            u2 = 1 - u1;
             *pVol += w * (v2 * (u2 * *(pProj + ui) + u1 * *(pProj + ui + 1)) +
                           v1 * (u2 * *(pProj + ui + pSize[0]) + u1 * *(pProj + ui + pSize[0] + 1)));
           }
 #else
-          ui = itk::Math::Round<double>(u);
+          ui = itk::Math::Round<TCoordinate>(u);
           if (ui >= 0 && ui < (int)pSize[0])
           {
             *pVol += w * *(pProj + ui);
@@ -228,11 +255,11 @@ FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojection
 }
 
 template <class TInputImage, class TOutputImage>
+template <class TCoordinate>
 void
-FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojectionY(
-  const OutputImageRegionType & region,
-  const ProjectionMatrixType &  matrix,
-  const ProjectionImagePointer  projection)
+FDKBackProjectionImageFilter<TInputImage, TOutputImage>::BackprojectAlongY(const OutputImageRegionType & region,
+                                                                        const ProjectionMatrixType &  matrix,
+                                                                        const ProjectionImagePointer  projection)
 {
   typename ProjectionImageType::SizeType  pSize = projection->GetBufferedRegion().GetSize();
   typename ProjectionImageType::IndexType pIndex = projection->GetBufferedRegion().GetIndex();
@@ -245,26 +272,27 @@ FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojection
   pVolZeroPointer = this->GetOutput()->GetBufferPointer();
   pVolZeroPointer -= vBufferIndex[0] + vBufferSize[0] * (vBufferIndex[1] + vBufferSize[1] * vBufferIndex[2]);
 
-  // Continuous index at which we interpolate
-  double u = NAN, v = NAN, w = NAN;
-  int    ui = 0, vi = 0;
-  double du = NAN;
+  // Continuous index at which we interpolate, in TCoordinate in the innermost
+  // loop and in double for the first voxel of each row
+  double      u0 = NAN, v = NAN, w0 = NAN;
+  TCoordinate u = NAN, w = NAN, du = NAN;
+  int         ui = 0, vi = 0;
 
   for (int k = region.GetIndex(2); k < region.GetIndex(2) + (int)region.GetSize(2); k++)
   {
     for (int i = region.GetIndex(0); i < region.GetIndex(0) + (int)region.GetSize(0); i++)
     {
       int j = region.GetIndex(1);
-      u = matrix[0][0] * i + matrix[0][1] * j + matrix[0][2] * k + matrix[0][3];
+      u0 = matrix[0][0] * i + matrix[0][1] * j + matrix[0][2] * k + matrix[0][3];
       v = matrix[1][0] * i + matrix[1][2] * k + matrix[1][3];
-      w = matrix[2][0] * i + matrix[2][2] * k + matrix[2][3];
+      w0 = matrix[2][0] * i + matrix[2][2] * k + matrix[2][3];
 
       // Apply perspective
-      w = 1 / w;
-      u = u * w - pIndex[0];
-      v = v * w - pIndex[1];
-      du = w * matrix[0][1];
-      w *= w;
+      w0 = 1 / w0;
+      u = u0 * w0 - pIndex[0];
+      v = v * w0 - pIndex[1];
+      du = w0 * matrix[0][1];
+      w = w0 * w0;
 
 #ifdef BILINEAR_BACKPROJECTION
       vi = itk::Math::floor(v);
@@ -282,17 +310,17 @@ FDKBackProjectionImageFilter<TInputImage, TOutputImage>::OptimizedBackprojection
           ui = itk::Math::floor(u);
           if (ui >= 0 && ui < (int)pSize[0] - 1)
           {
-            double u1 = NAN, u2 = NAN, v1 = NAN, v2 = NAN;
+            TCoordinate u1 = NAN, u2 = NAN, v1 = NAN, v2 = NAN;
             pProj = projection->GetBufferPointer() + vi * pSize[0] + ui;
             v1 = v - vi;
-            v2 = 1.0 - v1;
+            v2 = 1 - v1;
             u1 = u - ui;
-            u2 = 1.0 - u1;
+            u2 = 1 - u1;
             *pVol += w * (v2 * (u2 * *(pProj) + u1 * *(pProj + 1)) +
                           v1 * (u2 * *(pProj + pSize[0]) + u1 * *(pProj + pSize[0] + 1)));
           }
 #else
-          ui = itk::Math::Round<double>(u);
+          ui = itk::Math::Round<TCoordinate>(u);
           if (ui >= 0 && ui < (int)pSize[0])
           {
             pProj = projection->GetBufferPointer() + vi * pSize[0];
@@ -36,6 +36,11 @@ namespace rtk
  * reconstruction. This has been described in [Rit et al, TMI, 2009] and
  * [Rit et al, Med Phys, 2009].
  *
+ * The warped position of each voxel is stored in an image aligned with the
+ * output and it is only recomputed when the deformation output has been
+ * regenerated. It is therefore shared by successive projections with the same
+ * deformation, e.g., with CyclicDeformationImageFilter and a binned signal.
+ *
  * \test rtkmotioncompensatedfdktest.cxx
  *
  * \author Simon Rit
@@ -20,6 +20,7 @@
 #define rtkFDKWarpBackProjectionImageFilter_hxx
 
 
+#include <itkImageRegionIterator.h>
 #include <itkImageRegionIteratorWithIndex.h>
 #include <itkLinearInterpolateImageFunction.h>
 
@@ -76,13 +77,44 @@ FDKWarpBackProjectionImageFilter<TInputImage, TOutputImage, TDeformation>::Gener
   itk::Matrix<double, Dimension + 1, Dimension + 1> matrixVol =
     GetPhysicalPointToIndexMatrix<TOutputImage>(this->GetOutput());
 
+  // Warped physical point of each voxel, aligned with the output grid. It is
+  // only recomputed when the deformation has been updated and is otherwise
+  // reused, e.g., for all the projections of the same phase.
+  using WarpedPointImageType = itk::Image<itk::Vector<float, Dimension>, Dimension>;
+  auto warpedPoints = WarpedPointImageType::New();
+  warpedPoints->SetRegions(this->GetOutput()->GetRequestedRegion());
+  warpedPoints->Allocate();
+  itk::ModifiedTimeType warpedPointsMTime = 0;
+
   // Go over each projection
   for (unsigned int iProj = iFirstProj; iProj < iFirstProj + nProj; iProj++)
   {
     // Set the deformation
     m_Deformation->SetFrame(iProj);
     m_Deformation->Update();
-    warpInterpolator->SetInputImage(m_Deformation->GetOutput());
+    if (m_Deformation->GetOutput()->GetUpdateMTime() != warpedPointsMTime)
+    {
+      warpedPointsMTime = m_Deformation->GetOutput()->GetUpdateMTime();
+      warpInterpolator->SetInputImage(m_Deformation->GetOutput());
+      this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
+        this->GetOutput()->GetRequestedRegion(),
+        [this, warpInterpolator, warpedPoints](const typename TOutputImage::RegionType & outputRegionForThread) {
+          itk::ImageRegionIteratorWithIndex<WarpedPointImageType> itWarp(warpedPoints, outputRegionForThread);
+          typename WarpedPointImageType::PixelType                warpedPoint;
+          while (!itWarp.IsAtEnd())
+          {
+            typename TOutputImage::PointType point;
+            this->GetOutput()->TransformIndexToPhysicalPoint(itWarp.GetIndex(), point);
+            if (warpInterpolator->IsInsideBuffer(point))
+              point = point + warpInterpolator->Evaluate(point);
+            for (unsigned int i = 0; i < TOutputImage::ImageDimension; i++)
+              warpedPoint[i] = point[i];
+            itWarp.Set(warpedPoint);
+            ++itWarp;
+          }
+        },
+        nullptr);
+    }
 
     // Extract the current slice and create interpolator, could be any interpolation
     ProjectionImagePointer projection = this->template GetProjection<ProjectionImageType>(iProj);
@@ -99,19 +131,15 @@ FDKWarpBackProjectionImageFilter<TInputImage, TOutputImage, TDeformation>::Gener
 
     this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
       this->GetOutput()->GetRequestedRegion(),
-      [this, warpInterpolator, interpolator, matrix](const typename TOutputImage::RegionType & outputRegionForThread) {
-        using OutputRegionIterator = itk::ImageRegionIteratorWithIndex<TOutputImage>;
-        OutputRegionIterator itOut(this->GetOutput(), outputRegionForThread);
+      [this, warpedPoints, interpolator, matrix](const typename TOutputImage::RegionType & outputRegionForThread) {
+        itk::ImageRegionIterator<TOutputImage>              itOut(this->GetOutput(), outputRegionForThread);
+        itk::ImageRegionConstIterator<WarpedPointImageType> itWarp(warpedPoints, outputRegionForThread);
 
         // Go over each voxel
-        itOut.GoToBegin();
         while (!itOut.IsAtEnd())
         {
-          // Warp
-          typename TOutputImage::PointType point;
-          this->GetOutput()->TransformIndexToPhysicalPoint(itOut.GetIndex(), point);
-          if (warpInterpolator->IsInsideBuffer(point))
-            point = point + warpInterpolator->Evaluate(point);
+          // Warped point
+          const typename WarpedPointImageType::PixelType & point = itWarp.Get();
 
           // Compute projection index
           itk::ContinuousIndex<double, TOutputImage::ImageDimension - 1> pointProj;
@@ -138,6 +166,7 @@ FDKWarpBackProjectionImageFilter<TInputImage, TOutputImage, TDeformation>::Gener
           }
 
           ++itOut;
+          ++itWarp;
         }
       },
       nullptr);
@@ -22,6 +22,8 @@
 
 #include <itkImageRegionIterator.h>
 
+#include <vector>
+
 namespace rtk
 {
 
@@ -83,6 +85,10 @@ FDKWeightProjectionFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDat
   itI.GoToBegin();
   itO.GoToBegin();
 
+  // Per column factors of the current projection
+  std::vector<double> columnNumerators(outputRegionForThread.GetSize(0));
+  std::vector<double> columnDenominators(outputRegionForThread.GetSize(0));
+
   // Go over output, compute weights and avoid redundant computation
   for (int k = outputRegionForThread.GetIndex(2);
        k < outputRegionForThread.GetIndex(2) + (int)outputRegionForThread.GetSize(2);
@@ -103,16 +109,22 @@ FDKWeightProjectionFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDat
       const double numpart1 = sdd * (cosa + tana * sina);
       const double sddtana = sdd * tana;
 
+      // Precompute the factors which only depend on the column, i.e., the
+      // weighted numerator of cos(gamma) and the column term of its
+      // denominator
+      const double xBase = pointBase[0] + m_Geometry->GetProjectionOffsetsX()[k] + tana * RD;
+      for (unsigned int i = 0; i < outputRegionForThread.GetSize(0); i++)
+      {
+        const double x = xBase + i * pointIncrement[0];
+        columnNumerators[i] = m_ConstantProjectionFactor[k] * (numpart1 - x * sina);
+        columnDenominators[i] = (x - sddtana) * (x - sddtana);
+      }
+
       for (unsigned int j = 0; j < outputRegionForThread.GetSize(1); j++, point[1] += pointIncrement[1])
       {
-        point[0] = pointBase[0] + m_Geometry->GetProjectionOffsetsX()[k] + tana * RD;
         const double sdd2y2 = sdd2 + point[1] * point[1];
-        for (unsigned int i = 0; i < outputRegionForThread.GetSize(0); i++, ++itI, ++itO, point[0] += pointIncrement[0])
-        {
-          const double denom = sqrt(sdd2y2 + pow(point[0] - sddtana, 2.));
-          const double cosGamma = (numpart1 - point[0] * sina) / denom;
-          itO.Set(itI.Get() * m_ConstantProjectionFactor[k] * cosGamma);
-        }
+        for (unsigned int i = 0; i < outputRegionForThread.GetSize(0); i++, ++itI, ++itO)
+          itO.Set(itI.Get() * columnNumerators[i] / std::sqrt(sdd2y2 + columnDenominators[i]));
       }
     }
     else // Parallel
@@ -28,6 +28,8 @@
 #include <itkImageRegionIterator.h>
 #include <itkImageRegionIteratorWithIndex.h>
 
+#include <algorithm>
+
 namespace rtk
 {
 
@@ -206,11 +208,11 @@ FFTProjectionsConvolutionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::
   UpdateTruncationMirrorWeights();
   RegionType paddedRegion = GetPaddedImageRegion(inputRegion);
 
-  // Create padded image (spacing and origin do not matter)
+  // Create padded image (spacing and origin do not matter). It is not filled
+  // with zeros beforehand, each pixel is written once below.
   FFTInputImagePointer paddedImage = FFTInputImageType::New();
   paddedImage->SetRegions(paddedRegion);
   paddedImage->Allocate();
-  paddedImage->FillBuffer(0);
 
   const long next = std::min(inputRegion.GetIndex(0) - paddedRegion.GetIndex(0),
                              (typename FFTInputImageType::IndexValueType)this->GetTruncationCorrectionExtent());
@@ -260,16 +262,30 @@ FFTProjectionsConvolutionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::
     }
   }
 
-  // Copy central part
-  itk::ImageRegionConstIterator<InputImageType> itS(this->GetInput(), inputRegion);
-  itk::ImageRegionIterator<FFTInputImageType>   itD(paddedImage, inputRegion);
-  itS.GoToBegin();
-  itD.GoToBegin();
-  while (!itS.IsAtEnd())
+  // Copy central part row by row and set the rest of the row, apart from the
+  // mirrored parts, to zero
+  using IndexValueType = typename FFTInputImageType::IndexValueType;
+  const IndexValueType padBegin = paddedRegion.GetIndex(0);
+  const IndexValueType inBegin = inputRegion.GetIndex(0);
+  const IndexValueType inEnd = inBegin + inputRegion.GetSize(0);
+  const auto           padSize = static_cast<IndexValueType>(paddedRegion.GetSize(0));
+  RegionType           rowsRegion = paddedRegion;
+  rowsRegion.SetSize(0, 1);
+  itk::ImageRegionIteratorWithIndex<FFTInputImageType> itRow(paddedImage, rowsRegion);
+  for (; !itRow.IsAtEnd(); ++itRow)
   {
-    itD.Set(itS.Get());
-    ++itS;
-    ++itD;
+    TFFTPrecision *                       row = &(itRow.Value());
+    typename FFTInputImageType::IndexType idx = itRow.GetIndex();
+    idx[0] = inBegin;
+    if (!inputRegion.IsInside(idx))
+    {
+      std::fill(row, row + padSize, TFFTPrecision(0));
+      continue;
+    }
+    std::fill(row, row + (inBegin - next - padBegin), TFFTPrecision(0));
+    std::fill(row + (inEnd + next - padBegin), row + padSize, TFFTPrecision(0));
+    const typename InputImageType::PixelType * in = &(this->GetInput()->GetPixel(idx));
+    std::copy(in, in + inputRegion.GetSize(0), row + (inBegin - padBegin));
   }
 
   return paddedImage;
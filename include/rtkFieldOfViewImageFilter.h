@@ -38,6 +38,12 @@ namespace rtk
  * InPlaneAngle. The rest is accounted for but the fov is assumed to be
  * cylindrical.
  *
+ * The corners of all projections are visited with a single ray-based iterator
+ * to build the linear program giving the FOV radius. When the volume direction
+ * is the identity, the mask is then rasterized row by row: the x range of the
+ * FOV in each row is computed analytically and only its ends are tested voxel
+ * by voxel.
+ *
  * \test rtkfovtest.cxx, rtkfdktest.cxx, rtkmotioncompensatedfdktest.cxx
  *
  * \author Marc Vila
@@ -21,6 +21,7 @@
 
 #include "math.h"
 
+#include <memory>
 
 #include <itkImageRegionConstIterator.h>
 #include <itkImageRegionConstIteratorWithIndex.h>
@@ -43,13 +44,34 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::ComputeFOVRadius(const FOVRad
                                                                     double &            z,
                                                                     double &            r)
 {
+  const unsigned int nProj = m_Geometry->GetGantryAngles().size();
+
+  // Build a dummy projection stack with one pixel per detector corner so that a
+  // single ray-based iterator visits the four corners of all projections. Its
+  // origin and spacing are set so that index 0 and 1 of the first two
+  // dimensions map to the first and last pixel of the projections.
   m_ProjectionsStack->UpdateOutputInformation();
-  typename TInputImage::SizeType regSize;
-  regSize.Fill(1);
-  typename TInputImage::RegionType region = m_ProjectionsStack->GetLargestPossibleRegion();
-  region.SetSize(regSize);
+  const typename TInputImage::RegionType stackRegion = m_ProjectionsStack->GetLargestPossibleRegion();
+  typename TInputImage::IndexType        cornerIndex = stackRegion.GetIndex();
+  cornerIndex[2] = 0;
+  typename TInputImage::PointType cornerOrigin;
+  m_ProjectionsStack->TransformIndexToPhysicalPoint(cornerIndex, cornerOrigin);
+  typename TInputImage::SpacingType cornerSpacing = m_ProjectionsStack->GetSpacing();
+  typename TInputImage::RegionType  region;
+  region.GetModifiableIndex().Fill(0);
+  for (unsigned int i = 0; i < 2; i++)
+  {
+    region.SetSize(i, std::min<itk::SizeValueType>(stackRegion.GetSize(i), 2));
+    if (stackRegion.GetSize(i) > 1)
+      cornerSpacing[i] *= stackRegion.GetSize(i) - 1;
+  }
+  region.SetSize(2, nProj);
   auto dumImg = TInputImage::New();
   dumImg->CopyInformation(m_ProjectionsStack);
+  dumImg->SetOrigin(cornerOrigin);
+  dumImg->SetSpacing(cornerSpacing);
+  dumImg->SetRegions(region);
+  dumImg->Allocate();
 
   // Build model for lpsolve with 3 variables: x, z and r
   constexpr int Ncol = 3;
@@ -64,39 +86,41 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::ComputeFOVRadius(const FOVRad
 
   set_add_rowmode(lp, TRUE); // makes building the model faster if it is done rows by row
 
+  using InputRegionIterator = ProjectionsRegionConstIteratorRayBased<TInputImage>;
+  std::unique_ptr<InputRegionIterator> itIn;
+  if (nProj)
+    itIn.reset(InputRegionIterator::New(dumImg, region, m_Geometry));
+
   int  colno[Ncol] = { 1, 2, 3 };
   REAL row[Ncol];
-  for (unsigned int iProj = 0; iProj < m_Geometry->GetGantryAngles().size(); iProj++)
+  for (unsigned int iProj = 0; iProj < nProj; iProj++)
   {
     constexpr unsigned int NCORNERS = 4;
     double                 a[NCORNERS];
     double                 b[NCORNERS];
     double                 c[NCORNERS];
     double                 d[NCORNERS];
-    using InputRegionIterator = ProjectionsRegionConstIteratorRayBased<TInputImage>;
-    InputRegionIterator *                   itIn = nullptr;
+
+    // Collect the source and pixel positions of the (at most) four pixels of
+    // the current projection in the dummy stack
+    typename InputRegionIterator::PointType pixelSources[NCORNERS];
+    typename InputRegionIterator::PointType pixelPositions[NCORNERS];
+    for (unsigned int k = 0; k < region.GetSize(0) * region.GetSize(1); k++, ++(*itIn))
+    {
+      pixelSources[k] = itIn->GetSourcePosition();
+      pixelPositions[k] = itIn->GetPixelPosition();
+    }
+
     typename InputRegionIterator::PointType corners[NCORNERS];
     for (unsigned int i = 0; i < NCORNERS; i++)
     {
-      // Create image iterator with geometry for that particular pixel (== corner)
-      typename InputRegionIterator::PointType sourcePosition;
-      region.SetIndex(0,
-                      m_ProjectionsStack->GetLargestPossibleRegion().GetIndex()[0] +
-                        (i / 2) * (m_ProjectionsStack->GetLargestPossibleRegion().GetSize()[0] - 1));
-      region.SetIndex(1,
-                      m_ProjectionsStack->GetLargestPossibleRegion().GetIndex()[1] +
-                        (i % 2) * (m_ProjectionsStack->GetLargestPossibleRegion().GetSize()[1] - 1));
-      region.SetIndex(2, iProj);
-      dumImg->SetRegions(region);
-      dumImg->Allocate();
-      itIn = InputRegionIterator::New(dumImg, region, m_Geometry);
+      const unsigned int k = std::min<unsigned int>(i / 2, region.GetSize(0) - 1) +
+                             region.GetSize(0) * std::min<unsigned int>(i % 2, region.GetSize(1) - 1);
+      const typename InputRegionIterator::PointType & sourcePosition = pixelSources[k];
+      corners[i] = pixelPositions[k];
 
       // Compute the equation of a line of the ax+by=c
       // https://en.wikipedia.org/wiki/Linear_equation#Two-point_form
-      sourcePosition = itIn->GetSourcePosition();
-      corners[i] = itIn->GetPixelPosition();
-      delete itIn;
-
       a[i] = corners[i][2] - sourcePosition[2];
       b[i] = sourcePosition[0] - corners[i][0];
       c[i] = sourcePosition[0] * corners[i][2] - corners[i][0] * sourcePosition[2];
@@ -127,6 +151,7 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::ComputeFOVRadius(const FOVRad
     }
     else
     {
+      delete_lp(lp);
       itkExceptionMacro(<< "Error computing the FOV, unhandled detector rotation.");
     }
 
@@ -137,12 +162,18 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::ComputeFOVRadius(const FOVRad
       row[1] = b[0];
       row[2] = d[0];
       if (!add_constraintex(lp, 3, row, colno, LE, c[0]))
+      {
+        delete_lp(lp);
         itkExceptionMacro(<< "Couldn't add simplex constraint");
+      }
       row[0] = a[1];
       row[1] = b[1];
       row[2] = d[1];
       if (!add_constraintex(lp, 3, row, colno, LE, c[1]))
+      {
+        delete_lp(lp);
         itkExceptionMacro(<< "Couldn't add simplex constraint");
+      }
     }
     if (type == RADIUSSUP || type == RADIUSBOTH)
     {
@@ -150,12 +181,18 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::ComputeFOVRadius(const FOVRad
       row[1] = b[2];
       row[2] = d[2];
       if (!add_constraintex(lp, 3, row, colno, LE, c[2]))
+      {
+        delete_lp(lp);
         itkExceptionMacro(<< "Couldn't add simplex constraint");
+      }
       row[0] = a[3];
       row[1] = b[3];
       row[2] = d[3];
       if (!add_constraintex(lp, 3, row, colno, LE, c[3]))
+      {
+        delete_lp(lp);
         itkExceptionMacro(<< "Couldn't add simplex constraint");
+      }
     }
   }
 
@@ -299,7 +336,20 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
     OutputIterator itOut(this->GetOutput(), outputRegionForThread);
     itOut.GoToBegin();
 
-    // Go over output, compute weights and avoid redundant computation
+    // Exact test of a voxel, as in the general case below
+    const auto isInside = [this](double x, double y, double zsquare) {
+      double xsquare = m_CenterX - x;
+      xsquare *= xsquare;
+      double radius = std::sqrt(xsquare + zsquare);
+      return radius <= m_Radius && radius * m_HatTangentInf >= m_HatHeightInf - y &&
+             radius * m_HatTangentSup <= m_HatHeightSup - y;
+    };
+
+    // Go over output row by row. For each row, the conditions on the radius
+    // give an analytic upper bound of the radius and therefore of the x range
+    // of the FOV. Voxels outside this range are set without any test and the
+    // boundaries of the range are refined with the exact test.
+    const auto                      sizeX = static_cast<int>(outputRegionForThread.GetSize(0));
     typename TInputImage::PointType point = pointBase;
     for (unsigned int k = 0; k < outputRegionForThread.GetSize(2); k++)
     {
@@ -308,25 +358,58 @@ FieldOfViewImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
       point[1] = pointBase[1];
       for (unsigned int j = 0; j < outputRegionForThread.GetSize(1); j++)
       {
-        point[0] = pointBase[0];
-        for (unsigned int i = 0; i < outputRegionForThread.GetSize(0); i++)
+        // Upper bound of the radius in this row and existence of a lower bound
+        bool   empty = false;
+        bool   lowerBound = false;
+        double radiusMax = m_Radius;
+        if (m_HatTangentInf < 0.)
+          radiusMax = std::min(radiusMax, (m_HatHeightInf - point[1]) / m_HatTangentInf);
+        else if (m_HatTangentInf > 0.)
+          lowerBound = true;
+        else if (m_HatHeightInf - point[1] > 0.)
+          empty = true;
+        if (m_HatTangentSup > 0.)
+          radiusMax = std::min(radiusMax, (m_HatHeightSup - point[1]) / m_HatTangentSup);
+        else if (m_HatTangentSup < 0.)
+          lowerBound = true;
+        else if (m_HatHeightSup - point[1] < 0.)
+          empty = true;
+
+        // Conservative x range of the FOV in this row, in voxels
+        int iBegin = 0;
+        int iEnd = 0;
+        if (!empty && radiusMax >= 0. && radiusMax * radiusMax >= zsquare)
         {
-          double xsquare = m_CenterX - point[0];
-          xsquare *= xsquare;
-          double radius = std::sqrt(xsquare + zsquare);
-          if (radius <= m_Radius && radius * m_HatTangentInf >= m_HatHeightInf - point[1] &&
-              radius * m_HatTangentSup <= m_HatHeightSup - point[1])
-          {
-            if (m_Mask)
-              itOut.Set(this->m_InsideValue);
-            else
-              itOut.Set(itIn.Get());
-          }
-          else
+          const double halfWidth = std::sqrt(radiusMax * radiusMax - zsquare);
+          const double iMin = std::floor((m_CenterX - halfWidth - pointBase[0]) / pointIncrement[0]) - 1.;
+          const double iMax = std::ceil((m_CenterX + halfWidth - pointBase[0]) / pointIncrement[0]) + 2.;
+          iBegin = static_cast<int>(std::max(0., std::min(iMin, double(sizeX))));
+          iEnd = static_cast<int>(std::max(double(iBegin), std::min(iMax, double(sizeX))));
+        }
+
+        // Without lower bound, the FOV is convex and its intersection with the
+        // row is a segment whose ends are found with the exact test
+        if (!lowerBound)
+        {
+          while (iBegin < iEnd && !isInside(pointBase[0] + iBegin * pointIncrement[0], point[1], zsquare))
+            iBegin++;
+          while (iEnd > iBegin && !isInside(pointBase[0] + (iEnd - 1) * pointIncrement[0], point[1], zsquare))
+            iEnd--;
+        }
+
+        for (int i = 0; i < sizeX; i++)
+        {
+          bool inside = i >= iBegin && i < iEnd;
+          if (inside && lowerBound)
+            inside = isInside(pointBase[0] + i * pointIncrement[0], point[1], zsquare);
+          if (!inside)
             itOut.Set(this->m_OutsideValue);
+          else if (m_Mask)
+            itOut.Set(this->m_InsideValue);
+          else
+            itOut.Set(itIn.Get());
           ++itIn;
           ++itOut;
-          point[0] += pointIncrement[0];
         }
         point[1] += pointIncrement[1];
       }
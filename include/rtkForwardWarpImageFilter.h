@@ -32,6 +32,10 @@ namespace rtk
  * Deforms an image using a Displacement Vector Field. Adjoint operator
  * of the itkWarpImageFilter
  *
+ * The splat is multithreaded over slabs of the input. Each work unit
+ * accumulates values and weights in its own tile covering the part of the
+ * output reached by its slab, and tiles are added to the output afterwards.
+ *
  * \test rtkfourdroostertest
  *
  * \author Cyril Mory
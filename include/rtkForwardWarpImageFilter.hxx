@@ -23,11 +23,15 @@
 
 #include <itkImageRegionIterator.h>
 #include <itkImageRegionConstIteratorWithIndex.h>
-#include <itkNeighborhoodIterator.h>
-#include <itkConstantBoundaryCondition.h>
+#include <itkImageRegionIteratorWithIndex.h>
 #include <itkLinearInterpolateImageFunction.h>
 #include <itkMacro.h>
 
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <vector>
+
 namespace rtk
 {
 
@@ -138,6 +142,11 @@ template <class TInputImage, class TOutputImage, class TDVF>
 void
 ForwardWarpImageFilter<TInputImage, TOutputImage, TDVF>::GenerateData()
 {
+  constexpr unsigned int Dimension = TInputImage::ImageDimension;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using OutputRegionType = typename TOutputImage::RegionType;
+  using IndexValueType = typename TOutputImage::IndexValueType;
+
   Superclass::BeforeThreadedGenerateData();
   const DisplacementFieldType * fieldPtr = this->GetDisplacementField();
 
@@ -151,30 +160,18 @@ ForwardWarpImageFilter<TInputImage, TOutputImage, TDVF>::GenerateData()
   typename Superclass::InputImageConstPointer inputPtr = this->GetInput();
   typename Superclass::OutputImagePointer     outputPtr = this->GetOutput();
 
-  outputPtr->SetRegions(outputPtr->GetRequestedRegion());
+  const OutputRegionType outputRegion = outputPtr->GetRequestedRegion();
+  outputPtr->SetRegions(outputRegion);
   outputPtr->Allocate();
   outputPtr->FillBuffer(0);
 
   // Allocate an image with the same metadata as the output
   // to accumulate the weights during splat, and divide by the total weights at the end
   auto accumulate = TOutputImage::New();
-  accumulate->SetRegions(outputPtr->GetRequestedRegion());
+  accumulate->SetRegions(outputRegion);
   accumulate->Allocate();
   accumulate->FillBuffer(0);
 
-  // iterator for the output image
-  itk::ImageRegionConstIteratorWithIndex<TOutputImage>       inputIt(inputPtr, inputPtr->GetBufferedRegion());
-  itk::ImageRegionConstIterator<const DisplacementFieldType> fieldIt(fieldPtr, fieldPtr->GetBufferedRegion());
-  typename TOutputImage::IndexType                           index;
-  typename TOutputImage::IndexType                           baseIndex;
-  typename TOutputImage::IndexType                           neighIndex;
-  double                                                     distance[TInputImage::ImageDimension];
-  typename TOutputImage::PointType                           point;
-  typename Superclass::DisplacementType                      displacement;
-  itk::NumericTraits<typename Superclass::DisplacementType>::SetLength(displacement, TInputImage::ImageDimension);
-
-  unsigned int numNeighbors(1 << TInputImage::ImageDimension);
-
   // There is a bug in the ITK WarpImageFilter: m_DefFieldSizeSame
   // is computed without taking origin, spacing and direction into
   // account. So we perform a more thorough comparison between
@@ -185,128 +182,200 @@ ForwardWarpImageFilter<TInputImage, TOutputImage, TDVF>::GenerateData()
      (outputPtr->GetOrigin() == this->GetDisplacementField()->GetOrigin()) &&
      (outputPtr->GetDirection() == this->GetDisplacementField()->GetDirection()));
 
-  while (!inputIt.IsAtEnd())
-  {
-    // get the input image index
-    index = inputIt.GetIndex();
-    inputPtr->TransformIndexToPhysicalPoint(index, point);
-
-    if (skipEvaluateDisplacementAtContinuousIndex)
-      displacement = fieldIt.Get();
-    else
-      this->Protected_EvaluateDisplacementAtPhysicalPoint(point, displacement);
-
-    for (unsigned int j = 0; j < TInputImage::ImageDimension; j++)
-      point[j] += displacement[j];
-
-    using ValueType = typename TOutputImage::PointType::ValueType;
-    itk::ContinuousIndex<double, TInputImage::ImageDimension> continuousIndexInOutput =
-      outputPtr->template TransformPhysicalPointToContinuousIndex<ValueType, double>(point);
-
-    // compute the base index in output, ie the closest index below point
-    // Check if the baseIndex is in the output's requested region, otherwise skip the splat part
-    bool skip = false;
-
-    for (unsigned int j = 0; j < TInputImage::ImageDimension; j++)
-    {
-      baseIndex[j] = itk::Math::Floor<int, double>(continuousIndexInOutput[j]);
-      distance[j] = continuousIndexInOutput[j] - static_cast<double>(baseIndex[j]);
-      if ((baseIndex[j] < outputPtr->GetRequestedRegion().GetIndex()[j] - 1) ||
-          (baseIndex[j] >=
-           outputPtr->GetRequestedRegion().GetIndex()[j] + (int)outputPtr->GetRequestedRegion().GetSize()[j]))
-        skip = true;
-    }
+  // Splat. Each work unit processes a slab of the input and accumulates its
+  // contributions in its own tile, which covers the slab of the output reached
+  // by the warped input pixels. Tiles are then added to the output so that no
+  // two threads write in the same pixel concurrently.
+  const typename TOutputImage::OffsetValueType * offsetTable = outputPtr->GetOffsetTable();
+  std::mutex                                     accumulationLock;
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->template ParallelizeImageRegion<Dimension>(
+    inputPtr->GetBufferedRegion(),
+    [&](const typename TInputImage::RegionType & inputRegionForThread) {
+      // Continuous index in the output of each warped input pixel, kept in
+      // double so that the tile bounds computed below match the splat indices
+      std::vector<std::array<double, Dimension>> splatIndices;
+      splatIndices.reserve(inputRegionForThread.GetNumberOfPixels());
+      IndexValueType tileFirst = itk::NumericTraits<IndexValueType>::max();
+      IndexValueType tileLast = itk::NumericTraits<IndexValueType>::NonpositiveMin();
+
+      itk::ImageRegionConstIteratorWithIndex<TInputImage> inputIt(inputPtr, inputRegionForThread);
+      typename TOutputImage::PointType                    point;
+      typename Superclass::DisplacementType               displacement;
+      itk::NumericTraits<typename Superclass::DisplacementType>::SetLength(displacement, Dimension);
+      for (; !inputIt.IsAtEnd(); ++inputIt)
+      {
+        inputPtr->TransformIndexToPhysicalPoint(inputIt.GetIndex(), point);
+
+        if (skipEvaluateDisplacementAtContinuousIndex)
+          displacement = fieldPtr->GetPixel(inputIt.GetIndex());
+        else
+          this->Protected_EvaluateDisplacementAtPhysicalPoint(point, displacement);
+
+        for (unsigned int j = 0; j < Dimension; j++)
+          point[j] += displacement[j];
+
+        using ValueType = typename TOutputImage::PointType::ValueType;
+        const itk::ContinuousIndex<double, Dimension> continuousIndexInOutput =
+          outputPtr->template TransformPhysicalPointToContinuousIndex<ValueType, double>(point);
+        std::array<double, Dimension> splatIndex;
+        for (unsigned int j = 0; j < Dimension; j++)
+          splatIndex[j] = continuousIndexInOutput[j];
+        splatIndices.push_back(splatIndex);
+
+        const IndexValueType base = itk::Math::Floor<IndexValueType, double>(continuousIndexInOutput[Dimension - 1]);
+        tileFirst = std::min(tileFirst, base);
+        tileLast = std::max(tileLast, base + 1);
+      }
 
-    if (!skip)
-    {
-      // get the splat weights as the overlapping areas between
-      for (unsigned int counter = 0; counter < numNeighbors; counter++)
+      // Tile of the output region reached by this slab
+      tileFirst = std::max(tileFirst, outputRegion.GetIndex(Dimension - 1));
+      tileLast = std::min(tileLast,
+                          outputRegion.GetIndex(Dimension - 1) +
+                            static_cast<IndexValueType>(outputRegion.GetSize(Dimension - 1)) - 1);
+      if (tileFirst > tileLast)
+        return;
+      OutputRegionType tileRegion = outputRegion;
+      tileRegion.SetIndex(Dimension - 1, tileFirst);
+      tileRegion.SetSize(Dimension - 1, tileLast - tileFirst + 1);
+      std::vector<OutputPixelType> tileValues(tileRegion.GetNumberOfPixels(), 0);
+      std::vector<OutputPixelType> tileWeights(tileRegion.GetNumberOfPixels(), 0);
+      const typename TOutputImage::OffsetValueType tileOffset = outputPtr->ComputeOffset(tileRegion.GetIndex());
+
+      typename TOutputImage::IndexType baseIndex;
+      typename TOutputImage::IndexType neighIndex;
+      double                           distance[Dimension];
+      unsigned int                     numNeighbors(1 << Dimension);
+      auto                             splatIt = splatIndices.cbegin();
+      for (inputIt.GoToBegin(); !inputIt.IsAtEnd(); ++inputIt, ++splatIt)
       {
-        double       overlap = 1.0;   // fraction overlap
-        unsigned int upper = counter; // each bit indicates upper/lower neighbour
+        // compute the base index in output, ie the closest index below point
+        // Check if the baseIndex is in the output's requested region, otherwise skip the splat part
+        bool skip = false;
+        for (unsigned int j = 0; j < Dimension; j++)
+        {
+          baseIndex[j] = itk::Math::Floor<int, double>((*splatIt)[j]);
+          distance[j] = (*splatIt)[j] - static_cast<double>(baseIndex[j]);
+          if ((baseIndex[j] < outputRegion.GetIndex()[j] - 1) ||
+              (baseIndex[j] >= outputRegion.GetIndex()[j] + (int)outputRegion.GetSize()[j]))
+            skip = true;
+        }
+        if (skip)
+          continue;
+
+        const OutputPixelType value = inputIt.Get();
 
-        // get neighbor weights as the fraction of overlap
-        // of the neighbor pixels with a pixel centered on point
-        for (unsigned int dim = 0; dim < TInputImage::ImageDimension; dim++)
+        // get the splat weights as the overlapping areas between
+        for (unsigned int counter = 0; counter < numNeighbors; counter++)
         {
-          if (upper & 1)
+          double       overlap = 1.0;   // fraction overlap
+          unsigned int upper = counter; // each bit indicates upper/lower neighbour
+
+          // get neighbor weights as the fraction of overlap
+          // of the neighbor pixels with a pixel centered on point
+          typename TOutputImage::OffsetValueType offset = -tileOffset;
+          for (unsigned int dim = 0; dim < Dimension; dim++)
           {
-            neighIndex[dim] = baseIndex[dim] + 1;
-            overlap *= distance[dim];
+            if (upper & 1)
+            {
+              neighIndex[dim] = baseIndex[dim] + 1;
+              overlap *= distance[dim];
+            }
+            else
+            {
+              neighIndex[dim] = baseIndex[dim];
+              overlap *= 1.0 - distance[dim];
+            }
+            offset += (neighIndex[dim] - outputRegion.GetIndex()[dim]) * offsetTable[dim];
+
+            upper >>= 1;
           }
-          else
+
+          if (tileRegion.IsInside(neighIndex))
           {
-            neighIndex[dim] = baseIndex[dim];
-            overlap *= 1.0 - distance[dim];
+            // Perform splat with this weight, both in output and in the tile
+            // that accumulates weights
+            tileValues[offset] += overlap * value;
+            tileWeights[offset] += overlap;
           }
-
-          upper >>= 1;
-        }
-
-        if (outputPtr->GetRequestedRegion().IsInside(neighIndex))
-        {
-          // Perform splat with this weight, both in output and in the temporary
-          // image that accumulates weights
-          outputPtr->SetPixel(neighIndex, outputPtr->GetPixel(neighIndex) + overlap * inputIt.Get());
-          accumulate->SetPixel(neighIndex, accumulate->GetPixel(neighIndex) + overlap);
         }
       }
-    }
 
-    ++inputIt;
-    ++fieldIt;
-  }
+      // Add the tile to the output
+      std::lock_guard<std::mutex> mutexHolder(accumulationLock);
+      OutputPixelType *           outputBuffer = outputPtr->GetBufferPointer() + tileOffset;
+      OutputPixelType *           accumulateBuffer = accumulate->GetBufferPointer() + tileOffset;
+      for (size_t i = 0; i < tileValues.size(); i++)
+      {
+        outputBuffer[i] += tileValues[i];
+        accumulateBuffer[i] += tileWeights[i];
+      }
+    },
+    nullptr);
 
   // Divide the output by the accumulated weights, if they are non-zero
-  itk::ImageRegionIterator<TOutputImage> outputIt(outputPtr, outputPtr->GetRequestedRegion());
-  itk::ImageRegionIterator<TOutputImage> accIt(accumulate, outputPtr->GetRequestedRegion());
-  while (!outputIt.IsAtEnd())
-  {
-    if (accIt.Get())
-      outputIt.Set(outputIt.Get() / accIt.Get());
-
-    ++outputIt;
-    ++accIt;
-  }
-
-  // Replace the holes with the weighted mean of their neighbors
-  itk::Size<TOutputImage::ImageDimension> radius;
-  radius.Fill(3);
-  unsigned int pixelsInNeighborhood = 1;
-  for (unsigned int dim = 0; dim < TOutputImage::ImageDimension; dim++)
-    pixelsInNeighborhood *= 2 * radius[dim] + 1;
-
-  itk::NeighborhoodIterator<TOutputImage> outputIt2(radius, outputPtr, outputPtr->GetRequestedRegion());
-  itk::NeighborhoodIterator<TOutputImage> accIt2(radius, accumulate, outputPtr->GetRequestedRegion());
-
-  itk::ZeroFluxNeumannBoundaryCondition<TInputImage> zeroFlux;
-  outputIt2.OverrideBoundaryCondition(&zeroFlux);
-
-  itk::ConstantBoundaryCondition<TInputImage> constant;
-  accIt2.OverrideBoundaryCondition(&constant);
-
-  while (!outputIt2.IsAtEnd())
-  {
-    if (!accIt2.GetCenterPixel())
-    {
-      // Compute the mean of the neighboring pixels, weighted by the accumulated weights
-      typename TOutputImage::PixelType value = 0;
-      typename TOutputImage::PixelType weight = 0;
-      for (unsigned int idx = 0; idx < pixelsInNeighborhood; idx++)
+  this->GetMultiThreader()->template ParallelizeImageRegion<Dimension>(
+    outputRegion,
+    [outputPtr, accumulate](const OutputRegionType & outputRegionForThread) {
+      itk::ImageRegionIterator<TOutputImage> outputIt(outputPtr, outputRegionForThread);
+      itk::ImageRegionIterator<TOutputImage> accIt(accumulate, outputRegionForThread);
+      while (!outputIt.IsAtEnd())
       {
-        value += accIt2.GetPixel(idx) * outputIt2.GetPixel(idx);
-        weight += accIt2.GetPixel(idx);
+        if (accIt.Get())
+          outputIt.Set(outputIt.Get() / accIt.Get());
+
+        ++outputIt;
+        ++accIt;
       }
+    },
+    nullptr);
+
+  // Replace the holes with the weighted mean of their neighbors. Holes have a
+  // zero weight so they are never read when filling another hole.
+  this->GetMultiThreader()->template ParallelizeImageRegion<Dimension>(
+    outputRegion,
+    [outputPtr, accumulate, outputRegion](const OutputRegionType & outputRegionForThread) {
+      itk::Size<Dimension> radius;
+      radius.Fill(3);
+
+      itk::ImageRegionIteratorWithIndex<TOutputImage> outputIt(outputPtr, outputRegionForThread);
+      itk::ImageRegionConstIterator<TOutputImage>     accIt(accumulate, outputRegionForThread);
+      while (!outputIt.IsAtEnd())
+      {
+        if (!accIt.Get())
+        {
+          // Compute the mean of the neighboring pixels, weighted by the accumulated weights
+          OutputRegionType neighborhood;
+          neighborhood.SetIndex(outputIt.GetIndex());
+          neighborhood.SetSize(itk::Size<Dimension>::Filled(1));
+          neighborhood.PadByRadius(radius);
+          neighborhood.Crop(outputRegion);
+          itk::ImageRegionConstIterator<TOutputImage> neighOutputIt(outputPtr, neighborhood);
+          itk::ImageRegionConstIterator<TOutputImage> neighAccIt(accumulate, neighborhood);
+          OutputPixelType                             value = 0;
+          OutputPixelType                             weight = 0;
+          while (!neighAccIt.IsAtEnd())
+          {
+            if (neighAccIt.Get())
+            {
+              value += neighAccIt.Get() * neighOutputIt.Get();
+              weight += neighAccIt.Get();
+            }
+            ++neighOutputIt;
+            ++neighAccIt;
+          }
 
-      // Replace the hole with this value, or zero (if all surrounding pixels were holes)
-      if (weight)
-        outputIt2.SetCenterPixel(value / weight);
-      else
-        outputIt2.SetCenterPixel(0);
-    }
-    ++outputIt2;
-    ++accIt2;
-  }
+          // Replace the hole with this value, or zero (if all surrounding pixels were holes)
+          if (weight)
+            outputIt.Set(value / weight);
+          else
+            outputIt.Set(0);
+        }
+        ++outputIt;
+        ++accIt;
+      }
+    },
+    nullptr);
 
   Superclass::AfterThreadedGenerateData();
 }
@@ -284,6 +284,13 @@ SetProjectionsReaderFromGgo(TProjectionsReaderType * reader, const TArgsInfo & a
     reader->SetWaterPrecorrectionCoefficients(coeffs);
   }
 
+  // Prefetching of the files
+  if (args_info.readahead_arg < 0)
+  {
+    itkGenericExceptionMacro(<< "Number of read-ahead files must be positive or zero, got " << args_info.readahead_arg);
+  }
+  reader->SetNumberOfReadAheadFiles(args_info.readahead_arg);
+
   // Pass list to projections reader
   reader->SetFileNames(fileNames);
   TRY_AND_EXIT_ON_ITK_EXCEPTION(reader->UpdateOutputInformation());
@@ -482,6 +489,7 @@ SetForwardProjectionFromGgo(const TArgsInfo & args_info, TIterativeReconstructio
         recon->SetAttenuationMap(attenuationMap);
       break;
   }
+  recon->SetUseJosephRayTable(args_info.raytable_flag);
 }
 
 } // namespace rtk
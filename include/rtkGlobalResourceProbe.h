@@ -22,6 +22,9 @@
 #include "rtkResourceProbesCollector.h"
 #include "rtkWatcherForResourceProbe.h"
 #include <itkProcessObject.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
 
 namespace rtk
@@ -29,6 +32,17 @@ namespace rtk
 /** \class GlobalResourceProbe
  * \brief
  *
+ * Besides the aggregated probes, the probe can record a timeline of events
+ * when tracing is on: the beginning and end of each Update of the watched
+ * filters and the iterations reported by TraceIterationCommand. Each thread
+ * records its events without locking in its own ring buffer of
+ * TraceBufferSize events, the oldest events being overwritten. The timeline
+ * is exported with WriteTrace in the Chrome trace event format, which can be
+ * opened with chrome://tracing or https://ui.perfetto.dev. Tracing is
+ * switched on at construction if the environment variable RTK_TRACE_FILE is
+ * set, in which case the trace is written to this file when the probe is
+ * destroyed.
+ *
  * \ingroup RTK OSSystemObjects
  * \ingroup RTK ITKCommon
  */
@@ -89,6 +103,41 @@ public:
   virtual void
   Remove(const rtk::WatcherForResourceProbe * w);
 
+  /** Set / Get whether events are recorded in the trace */
+  itkSetMacro(Tracing, bool);
+  itkGetMacro(Tracing, bool);
+  itkBooleanMacro(Tracing);
+
+  /** Maximum number of events kept per thread */
+  static constexpr size_t TraceBufferSize = 1 << 16;
+
+  /** Time in microseconds since the creation of the probe, used as time
+   * origin of the trace. */
+  double
+  GetTraceTime() const;
+
+  /** Record the beginning / end of a duration event in the trace of the
+   * calling thread. name and category must be string literals or outlive
+   * the probe, e.g., the result of GetNameOfClass(). object is used to
+   * distinguish the instances of a filter and may be null. Nothing is
+   * recorded if tracing is off. */
+  void
+  TraceBegin(const char * name, const char * category, const void * object = nullptr);
+  void
+  TraceEnd(const char * name, const char * category, const void * object = nullptr);
+
+  /** Record an event which started at time begin (see GetTraceTime) and ends
+   * now. value is exported as an argument of the event if it is not
+   * negative, e.g., an iteration number. */
+  void
+  TraceComplete(const char * name, const char * category, double begin, long long value = -1);
+
+  /** Write the events recorded in the trace in the Chrome trace event (JSON)
+   * format. It must not be called while filters are being updated: the list
+   * of buffers is protected but not the events of each buffer. */
+  virtual void
+  WriteTrace(std::ostream & os) const;
+
 protected:
   GlobalResourceProbe();
   ~GlobalResourceProbe() override;
@@ -100,8 +149,36 @@ protected:
   std::vector<rtk::WatcherForResourceProbe *> m_Watchers;
 
 private:
-  static Pointer m_Instance;
-  std::mutex     m_Mutex;
+  /** One event of the trace */
+  struct TraceEvent
+  {
+    const char * Name;
+    const char * Category;
+    const void * Object;
+    double       Timestamp;
+    double       Duration;
+    long long    Value;
+    char         Phase;
+  };
+
+  /** Ring buffer of the events of one thread, only written by this thread */
+  struct TraceBuffer
+  {
+    std::vector<TraceEvent> Events;
+    std::atomic<size_t>     Count{ 0 };
+    unsigned int            ThreadIndex{ 0 };
+  };
+
+  void
+  AddTraceEvent(const TraceEvent & event);
+
+  static Pointer     m_Instance;
+  mutable std::mutex m_Mutex;
+
+  std::atomic<bool>                         m_Tracing{ false };
+  std::string                               m_TraceFileName;
+  std::chrono::steady_clock::time_point     m_TraceOrigin;
+  std::vector<std::unique_ptr<TraceBuffer>> m_TraceBuffers;
 };
 } // namespace rtk
 
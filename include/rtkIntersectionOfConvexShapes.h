@@ -70,6 +70,10 @@ public:
                      ScalarType &       infDist,
                      ScalarType &       supDist) const override;
 
+  /** Intersection of the bounding boxes of the bounded shapes. */
+  bool
+  GetBoundingBox(PointType & inf, PointType & sup) const override;
+
   /** Add convex object to phantom. */
   void
   AddConvexShape(const ConvexShape * co);
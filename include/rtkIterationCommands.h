@@ -19,6 +19,8 @@
 #ifndef rtkIterationCommands_h
 #define rtkIterationCommands_h
 
+#include "rtkGlobalResourceProbe.h"
+
 #include <itkImageFileWriter.h>
 
 namespace rtk
@@ -57,6 +59,11 @@ public:
     const auto * cCaller = dynamic_cast<const TCaller *>(caller);
     if (cCaller)
     {
+      if (itk::StartEvent().CheckEvent(&event))
+      {
+        Start(cCaller);
+        return;
+      }
       if (itk::EndEvent().CheckEvent(&event))
       {
         End(cCaller);
@@ -84,6 +91,12 @@ protected:
   virtual void
   Run(const TCaller * caller) = 0;
 
+  /** Callback function executed when filter starts. */
+  virtual void
+  Start(const TCaller * itkNotUsed(caller))
+  { /* Default implementation: do nothing */
+  }
+
   /** Callback function executed when filter concludes. */
   virtual void
   End(const TCaller * itkNotUsed(caller))
@@ -124,6 +137,47 @@ protected:
   }
 };
 
+/** \class TraceIterationCommand
+ * \brief Records the duration of each iteration in the trace of
+ * GlobalResourceProbe.
+ *
+ * Each event spans the TriggerEvery iterations preceding its Run(). Nothing
+ * is recorded if tracing is off in GlobalResourceProbe.
+ *
+ * \author Simon Rit
+ *
+ * \ingroup RTK
+ *
+ */
+template <typename TCaller>
+class ITK_TEMPLATE_EXPORT TraceIterationCommand : public IterationCommand<TCaller>
+{
+public:
+  /** Standard class typedefs. */
+  using Self = TraceIterationCommand;
+  using Superclass = IterationCommand<TCaller>;
+  using Pointer = itk::SmartPointer<Self>;
+  itkNewMacro(Self);
+
+protected:
+  /** Beginning of the current iteration in the time base of the trace */
+  double m_IterationBegin = 0.;
+
+  void
+  Start(const TCaller * itkNotUsed(caller)) override
+  {
+    m_IterationBegin = GlobalResourceProbe::GetInstance()->GetTraceTime();
+  }
+
+  void
+  Run(const TCaller * itkNotUsed(caller)) override
+  {
+    GlobalResourceProbe::Pointer probe = GlobalResourceProbe::GetInstance();
+    probe->TraceComplete("Iteration", "iteration", m_IterationBegin, this->m_IterationCount);
+    m_IterationBegin = probe->GetTraceTime();
+  }
+};
+
 /** \class OutputIterationCommand
  * \brief Output intermediate iterations in a file.
  * This class is useful to check convergence of an iterative method
@@ -172,6 +172,14 @@ public:
   itkGetConstMacro(StepSize, double);
   itkSetMacro(StepSize, double);
 
+  /** Share a rtk::JosephRayTable between the Joseph forward and back
+   * projectors so that the intersections of the rays with the volume are
+   * computed once for all iterations. This requires two floats per pixel of
+   * the projections. Default is off. */
+  itkGetMacro(UseJosephRayTable, bool);
+  itkSetMacro(UseJosephRayTable, bool);
+  itkBooleanMacro(UseJosephRayTable);
+
 protected:
   IterativeConeBeamReconstructionFilter();
   ~IterativeConeBeamReconstructionFilter() override = default;
@@ -186,6 +194,11 @@ protected:
   virtual ForwardProjectionPointerType
   InstantiateForwardProjectionFilter(int fwtype);
 
+  /** Returns the ray table shared by the Joseph projectors, created on first
+   * call. */
+  JosephRayTable *
+  GetJosephRayTable();
+
   /** Internal variables storing the current forward
     and back projection methods */
   ForwardProjectionType m_CurrentForwardProjectionConfiguration;
@@ -202,6 +215,10 @@ protected:
   /** Step size along ray (in mm). */
   double m_StepSize{ 1.0 };
 
+  /** Ray table shared by the Joseph projectors */
+  bool                    m_UseJosephRayTable{ false };
+  JosephRayTable::Pointer m_JosephRayTable;
+
   /** Instantiate forward and back projectors using SFINAE. */
   using CPUImageType =
     typename itk::Image<typename ProjectionStackType::PixelType, ProjectionStackType::ImageDimension>;
@@ -313,6 +330,10 @@ protected:
     {
       josephAttenuatedForward->SetInferiorClipImage(this->GetInferiorClipImage());
     }
+    if (m_UseJosephRayTable)
+    {
+      josephAttenuatedForward->SetRayTable(this->GetJosephRayTable());
+    }
     return josephAttenuatedForward.GetPointer();
   }
 
@@ -418,12 +439,15 @@ protected:
   BackProjectionPointerType
   InstantiateJosephBackAttenuatedProjection()
   {
-    BackProjectionPointerType bp;
-    bp = JosephBackAttenuatedProjectionImageFilter<ImageType, ImageType>::New();
+    auto bp = JosephBackAttenuatedProjectionImageFilter<ImageType, ImageType>::New();
+    if (m_UseJosephRayTable)
+    {
+      bp->SetRayTable(this->GetJosephRayTable());
+    }
     if (this->GetAttenuationMap().IsNotNull())
     {
       bp->SetInput(2, this->GetAttenuationMap());
-      return bp;
+      return bp.GetPointer();
     }
     else
     {
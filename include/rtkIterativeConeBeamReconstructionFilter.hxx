@@ -49,6 +49,11 @@ IterativeConeBeamReconstructionFilter<TOutputImage, ProjectionStackType>::Instan
         dynamic_cast<rtk::JosephForwardProjectionImageFilter<VolumeType, ProjectionStackType> *>(fw.GetPointer())
           ->SetInferiorClipImage(this->GetInferiorClipImage());
       }
+      if (m_UseJosephRayTable)
+      {
+        dynamic_cast<rtk::JosephForwardProjectionImageFilter<VolumeType, ProjectionStackType> *>(fw.GetPointer())
+          ->SetRayTable(this->GetJosephRayTable());
+      }
       break;
     case (FP_CUDARAYCAST):
       fw = InstantiateCudaForwardProjection<ProjectionStackType>();
@@ -80,6 +85,11 @@ IterativeConeBeamReconstructionFilter<TOutputImage, ProjectionStackType>::Instan
       break;
     case (BP_JOSEPH):
       bp = JosephBackProjectionImageFilter<ProjectionStackType, VolumeType>::New();
+      if (m_UseJosephRayTable)
+      {
+        dynamic_cast<rtk::JosephBackProjectionImageFilter<ProjectionStackType, VolumeType> *>(bp.GetPointer())
+          ->SetRayTable(this->GetJosephRayTable());
+      }
       break;
     case (BP_CUDAVOXELBASED):
       bp = InstantiateCudaBackProjection<ProjectionStackType>();
@@ -126,6 +136,15 @@ IterativeConeBeamReconstructionFilter<TOutputImage, ProjectionStackType>::SetBac
   }
 }
 
+template <class TOutputImage, class ProjectionStackType>
+JosephRayTable *
+IterativeConeBeamReconstructionFilter<TOutputImage, ProjectionStackType>::GetJosephRayTable()
+{
+  if (m_JosephRayTable.IsNull())
+    m_JosephRayTable = JosephRayTable::New();
+  return m_JosephRayTable;
+}
+
 } // end namespace rtk
 
 #endif // rtkIterativeConeBeamReconstructionFilter_hxx
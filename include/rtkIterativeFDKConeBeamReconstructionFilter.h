@@ -44,6 +44,12 @@ namespace rtk
  * - Difference between the calculated projections and the input ones,
  * - Multiplication by a small constant
  * This "projections correction" is used at the next iteration to improve the FDK.
+ * The forward projection is accumulated onto the negated input projections and
+ * the difference is then multiplied by -lambda over the intersection length of
+ * the rays with the volume. These two projection stacks do not depend on the
+ * volume so they are only computed once. The Zeng forward projector does not
+ * accumulate onto its input 0, it is therefore given a null projection stack
+ * and the input projections are subtracted from its output.
  *
  * \dot
  * digraph IterativeFDKConeBeamReconstructionFilter {
@@ -59,19 +65,18 @@ namespace rtk
  * Displaced [ label="rtk::DisplacedDetectorImageFilter" URL="\ref rtk::DisplacedDetectorImageFilter"];
  * Parker [ label="rtk::ParkerShortScanImageFilter" URL="\ref rtk::ParkerShortScanImageFilter"];
  * FDK [ label="rtk::FDKConeBeamReconstructionFilter" URL="\ref rtk::FDKConeBeamReconstructionFilter"];
- * Subtract [ label="itk::SubtractImageFilter" URL="\ref itk::SubtractImageFilter"];
- * Multiply [ label="itk::MultiplyImageFilter (by lambda)" URL="\ref itk::MultiplyImageFilter"];
+ * Subtract [ label="itk::SubtractImageFilter (from 0)" URL="\ref itk::SubtractImageFilter"];
+ * Multiply [ label="itk::MultiplyImageFilter" URL="\ref itk::MultiplyImageFilter"];
  * ConstantProjectionStack [ label="rtk::ConstantImageSource (projections)" URL="\ref rtk::ConstantImageSource"];
  * ForwardProjection [ label="rtk::ForwardProjectionImageFilter" URL="\ref rtk::ForwardProjectionImageFilter"];
  * RayBox [ label="rtk::RayBoxIntersectionImageFilter" URL="\ref rtk::RayBoxIntersectionImageFilter"];
  * Threshold [ label="itk::ThresholdImageFilter" URL="\ref itk::ThresholdImageFilter"];
- * Divide [ label="itk::DivideOrZeroOutImageFilter" URL="\ref itk::DivideOrZeroOutImageFilter"];
+ * Divide [ label="itk::DivideOrZeroOutImageFilter (-lambda by)" URL="\ref itk::DivideOrZeroOutImageFilter"];
  *
  * AfterInput1 [label="", fixedsize="false", width=0, height=0, shape=none];
  * AfterInput0 [label="", fixedsize="false", width=0, height=0, shape=none];
  * AfterThreshold [label="", fixedsize="false", width=0, height=0, shape=none];
- * AfterConstantSource [label="", fixedsize="false", width=0, height=0, shape=none];
- * AfterDivide [label="", fixedsize="false", width=0, height=0, shape=none];
+ * AfterMultiply [label="", fixedsize="false", width=0, height=0, shape=none];
  *
  * Input1 -> AfterInput1 [arrowhead=none];
  * AfterInput1 -> Displaced;
@@ -79,21 +84,19 @@ namespace rtk
  * Parker -> FDK;
  * Input0 -> AfterInput0;
  * AfterInput0 -> FDK;
- * ConstantProjectionStack -> AfterConstantSource [arrowhead=none];
- * AfterConstantSource -> ForwardProjection;
- * AfterConstantSource -> RayBox;
+ * ConstantProjectionStack -> RayBox;
  * RayBox -> Divide;
  * FDK -> Threshold;
  * Threshold -> AfterThreshold [arrowhead=none];
  * AfterThreshold -> ForwardProjection;
  * AfterInput1 -> Subtract;
- * ForwardProjection -> Subtract;
- * Subtract -> Multiply;
- * Multiply -> Divide;
+ * Subtract -> ForwardProjection;
+ * ForwardProjection -> Multiply;
+ * Divide -> Multiply;
  * AfterThreshold -> Output;
  * AfterThreshold -> AfterInput0 [style=dashed, constraint=false];
- * Divide -> AfterDivide;
- * AfterDivide -> AfterInput1 [style=dashed, constraint=false];
+ * Multiply -> AfterMultiply;
+ * AfterMultiply -> AfterInput1 [style=dashed, constraint=false];
  * }
  * \enddot
  *
@@ -117,19 +117,44 @@ IterativeFDKConeBeamReconstructionFilter<TInputImage, TOutputImage, TFFTPrecisio
   m_FDKFilter->SetInput(0, this->GetInput(0));
   m_FDKFilter->SetInput(1, m_ParkerFilter->GetOutput());
 
-  m_ForwardProjectionFilter->SetInput(0, m_ConstantProjectionStackSource->GetOutput());
+  // The residual is weighted by -lambda over the intersection length with the
+  // volume box. These weights do not depend on the volume and are therefore
+  // only computed at the first iteration.
+  m_RayBoxFilter->SetInput(m_ConstantProjectionStackSource->GetOutput());
+
+  m_DivideFilter->SetConstant1(-m_Lambda);
+  m_DivideFilter->SetInput2(m_RayBoxFilter->GetOutput());
+  m_DivideFilter->SetInPlace(false);
+
   m_ForwardProjectionFilter->SetInput(1, m_FDKFilter->GetOutput());
+  m_ForwardProjectionFilter->SetInPlace(false);
+  if (this->m_CurrentForwardProjectionConfiguration == Superclass::FP_ZENG)
+  {
+    // The Zeng projector overwrites its input 0 with the forward projection,
+    // the measured projections are subtracted afterwards
+    m_ForwardProjectionFilter->SetInput(0, m_ConstantProjectionStackSource->GetOutput());
 
-  m_SubtractFilter->SetInput1(this->GetInput(1));
-  m_SubtractFilter->SetInput2(m_ForwardProjectionFilter->GetOutput());
+    m_SubtractFilter->SetInput1(m_ForwardProjectionFilter->GetOutput());
+    m_SubtractFilter->SetInput2(this->GetInput(1));
+    m_SubtractFilter->SetInPlace(true);
 
-  m_RayBoxFilter->SetInput(m_ConstantProjectionStackSource->GetOutput());
+    m_MultiplyFilter->SetInput1(m_SubtractFilter->GetOutput());
+  }
+  else
+  {
+    // The forward projector accumulates onto the negated measured projections,
+    // so that its output is directly the opposite of the residual. The negated
+    // projections do not depend on the volume and are therefore only computed
+    // at the first iteration.
+    m_SubtractFilter->SetConstant1(0.);
+    m_SubtractFilter->SetInput2(this->GetInput(1));
+    m_SubtractFilter->SetInPlace(false);
 
-  m_MultiplyFilter->SetInput1(m_SubtractFilter->GetOutput());
-  m_MultiplyFilter->SetConstant2(m_Lambda);
+    m_ForwardProjectionFilter->SetInput(0, m_SubtractFilter->GetOutput());
 
-  m_DivideFilter->SetInput1(m_MultiplyFilter->GetOutput());
-  m_DivideFilter->SetInput2(m_RayBoxFilter->GetOutput());
+    m_MultiplyFilter->SetInput1(m_ForwardProjectionFilter->GetOutput());
+  }
+  m_MultiplyFilter->SetInput2(m_DivideFilter->GetOutput());
 
   m_DisplacedDetectorFilter->SetGeometry(m_Geometry);
   m_ParkerFilter->SetGeometry(m_Geometry);
@@ -147,7 +172,7 @@ IterativeFDKConeBeamReconstructionFilter<TInputImage, TOutputImage, TFFTPrecisio
   }
 
   // Update output information on the last filter of the pipeline
-  m_DivideFilter->UpdateOutputInformation();
+  m_MultiplyFilter->UpdateOutputInformation();
 
   // Copy the information from the filter that will actually return the output
   if (m_EnforcePositivity)
@@ -181,7 +206,7 @@ IterativeFDKConeBeamReconstructionFilter<TInputImage, TOutputImage, TFFTPrecisio
   // For each iteration over 1, go over each projection
   for (unsigned int iter = 1; iter < m_NumberOfIterations; iter++)
   {
-    m_DivideFilter->Update();
+    m_MultiplyFilter->Update();
 
     // Use previous iteration's result as input volume in next iteration
     if (m_EnforcePositivity)
@@ -199,24 +224,23 @@ IterativeFDKConeBeamReconstructionFilter<TInputImage, TOutputImage, TFFTPrecisio
 
     // Use correction projections as input projections in next iteration
     // No broken link to re-create
-    p_projs = m_DivideFilter->GetOutput();
+    p_projs = m_MultiplyFilter->GetOutput();
     p_projs->DisconnectPipeline();
     m_DisplacedDetectorFilter->SetInput(p_projs);
 
     // Run the next reconstruction
     if (m_EnforcePositivity)
-    {
       m_ThresholdFilter->Update();
-      this->GraftOutput(m_ThresholdFilter->GetOutput());
-    }
     else
-    {
       m_FDKFilter->Update();
-      this->GraftOutput(m_FDKFilter->GetOutput());
-    }
 
     iterationReporter.CompletedStep();
   }
+
+  if (m_EnforcePositivity)
+    this->GraftOutput(m_ThresholdFilter->GetOutput());
+  else
+    this->GraftOutput(m_FDKFilter->GetOutput());
 }
 
 } // end namespace rtk
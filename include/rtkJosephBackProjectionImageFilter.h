@@ -21,6 +21,7 @@
 
 #include "rtkConfiguration.h"
 #include "rtkBackProjectionImageFilter.h"
+#include "rtkJosephRayTable.h"
 #include "rtkThreeDCircularProjectionGeometry.h"
 
 #include <itkVectorImage.h>
@@ -256,6 +257,12 @@ public:
   itkGetMacro(SuperiorClip, double);
   itkSetMacro(SuperiorClip, double);
 
+  /** Optional table of the intersections of the rays with the volume, see
+   * rtk::JosephRayTable. If set, the intersections are only computed for the
+   * projections which are not in the table yet. */
+  itkGetModifiableObjectMacro(RayTable, JosephRayTable);
+  itkSetObjectMacro(RayTable, JosephRayTable);
+
 protected:
   JosephBackProjectionImageFilter();
   ~JosephBackProjectionImageFilter() override = default;
@@ -331,6 +338,7 @@ protected:
   TSumAlongRay                       m_SumAlongRay;
   double                             m_InferiorClip{ 0. };
   double                             m_SuperiorClip{ 1. };
+  JosephRayTable::Pointer            m_RayTable;
 };
 
 } // end namespace rtk
@@ -120,6 +120,8 @@ JosephBackProjectionImageFilter<TInputImage,
   }
   box->SetBoxMin(boxMin);
   box->SetBoxMax(boxMax);
+  if (m_RayTable.IsNotNull())
+    m_RayTable->Update(this->GetInput(1), buffReg, geometry, volPPToIndex, box, this->GetMultiThreader());
 
   // m_InferiorClip and m_SuperiorClip are understood in the sense of a
   // source-to-pixel vector. Since we go from pixel-to-source, we invert them.
@@ -146,9 +148,18 @@ JosephBackProjectionImageFilter<TInputImage,
 
     // Test if there is an intersection
     BoxShape::ScalarType infDist = NAN, supDist = NAN;
-    if (box->IsIntersectedByRay(pixelPosition, dirVox, infDist, supDist) &&
-        supDist >= 0. && // check if detector after the source
-        infDist <= 1.)   // check if detector after or in the volume
+    bool                 isIntersectByRay = false;
+    if (m_RayTable.IsNotNull())
+    {
+      const JosephRayTable::Ray & ray = m_RayTable->GetRay(itIn->GetIndex());
+      infDist = ray.InfDist;
+      supDist = ray.SupDist;
+      isIntersectByRay = infDist <= supDist;
+    }
+    else
+      isIntersectByRay = box->IsIntersectedByRay(pixelPosition, dirVox, infDist, supDist);
+    if (isIntersectByRay && supDist >= 0. && // check if detector after the source
+        infDist <= 1.)                       // check if detector after or in the volume
     {
       // Clip the casting between source and pixel of the detector
       infDist = std::max(infDist, inferiorClip);
@@ -172,6 +172,7 @@ JosephForwardAttenuatedProjectionImageFilter<TInputImage,
                                              TProjectedValueAccumulation,
                                              TComputeAttenuationCorrection>::BeforeThreadedGenerateData()
 {
+  Superclass::BeforeThreadedGenerateData();
   if (!this->GetInput(2))
   {
     itkExceptionMacro("Attenuation map (input 2) must be set before running the attenuated forward projector.");
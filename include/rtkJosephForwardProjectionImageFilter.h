@@ -21,7 +21,9 @@
 
 #include "rtkConfiguration.h"
 #include "rtkForwardProjectionImageFilter.h"
+#include "rtkJosephRayTable.h"
 #include "rtkMacro.h"
+#include <itkImageRegionSplitterMultidimensional.h>
 #include <itkPixelTraits.h>
 
 #include "rtkProjectionsRegionConstIteratorRayBased.h"
@@ -298,6 +300,12 @@ public:
   itkGetMacro(SuperiorClip, double);
   itkSetMacro(SuperiorClip, double);
 
+  /** Optional table of the intersections of the rays with the volume, see
+   * rtk::JosephRayTable. If set, the intersections are only computed for the
+   * projections which are not in the table yet. */
+  itkGetModifiableObjectMacro(RayTable, JosephRayTable);
+  itkSetObjectMacro(RayTable, JosephRayTable);
+
 protected:
   JosephForwardProjectionImageFilter();
   ~JosephForwardProjectionImageFilter() override = default;
@@ -306,9 +314,18 @@ protected:
   void
   GenerateInputRequestedRegion() override;
 
+  /** Fill the ray table if any. */
+  void
+  BeforeThreadedGenerateData() override;
+
   void
   ThreadedGenerateData(const OutputImageRegionType & outputRegionForThread, ThreadIdType threadId) override;
 
+  /** Splits the output requested region along all directions so that all
+   * threads are busy even with few projections, e.g., with small subsets. */
+  [[nodiscard]] const itk::ImageRegionSplitterBase *
+  GetImageRegionSplitter() const override;
+
   /** If a third input is given, it should be in the same physical space
    * as the first one. */
   void
@@ -349,6 +366,9 @@ private:
   TSumAlongRay                       m_SumAlongRay;
   double                             m_InferiorClip{ 0. };
   double                             m_SuperiorClip{ 1. };
+  JosephRayTable::Pointer            m_RayTable;
+
+  itk::ImageRegionSplitterMultidimensional::Pointer m_Splitter;
 };
 
 } // end namespace rtk
@@ -43,6 +43,25 @@ JosephForwardProjectionImageFilter<TInputImage,
                                    TSumAlongRay>::JosephForwardProjectionImageFilter()
 {
   this->DynamicMultiThreadingOff();
+
+  // The default splitter only splits the slowest direction, i.e., the
+  // projections, which leaves threads idle with small subsets of projections.
+  m_Splitter = itk::ImageRegionSplitterMultidimensional::New();
+}
+
+template <class TInputImage,
+          class TOutputImage,
+          class TInterpolationWeightMultiplication,
+          class TProjectedValueAccumulation,
+          class TSumAlongRay>
+const itk::ImageRegionSplitterBase *
+JosephForwardProjectionImageFilter<TInputImage,
+                                   TOutputImage,
+                                   TInterpolationWeightMultiplication,
+                                   TProjectedValueAccumulation,
+                                   TSumAlongRay>::GetImageRegionSplitter() const
+{
+  return m_Splitter;
 }
 
 
@@ -169,6 +188,42 @@ JosephForwardProjectionImageFilter<TInputImage,
 }
 
 
+template <class TInputImage,
+          class TOutputImage,
+          class TInterpolationWeightMultiplication,
+          class TProjectedValueAccumulation,
+          class TSumAlongRay>
+void
+JosephForwardProjectionImageFilter<TInputImage,
+                                   TOutputImage,
+                                   TInterpolationWeightMultiplication,
+                                   TProjectedValueAccumulation,
+                                   TSumAlongRay>::BeforeThreadedGenerateData()
+{
+  if (m_RayTable.IsNull())
+    return;
+
+  // Same box as in ThreadedGenerateData
+  auto                         box = BoxShape::New();
+  typename BoxShape::PointType boxMin, boxMax;
+  for (unsigned int i = 0; i < TInputImage::ImageDimension; i++)
+  {
+    boxMin[i] = this->GetInput(1)->GetBufferedRegion().GetIndex()[i];
+    boxMax[i] =
+      this->GetInput(1)->GetBufferedRegion().GetIndex()[i] + this->GetInput(1)->GetBufferedRegion().GetSize()[i] - 1;
+    boxMax[i] *= 1. - itk::NumericTraits<BoxShape::ScalarType>::epsilon();
+  }
+  box->SetBoxMin(boxMin);
+  box->SetBoxMax(boxMax);
+
+  m_RayTable->Update(this->GetInput(),
+                     this->GetOutput()->GetRequestedRegion(),
+                     this->GetGeometry(),
+                     GetPhysicalPointToIndexMatrix(this->GetInput(1)),
+                     box,
+                     this->GetMultiThreader());
+}
+
 template <class TInputImage,
           class TOutputImage,
           class TInterpolationWeightMultiplication,
@@ -269,7 +324,16 @@ JosephForwardProjectionImageFilter<TInputImage,
 
     // Test if there is an intersection
     BoxShape::ScalarType infDist = NAN, supDist = NAN;
-    bool                 isIntersectByRay = box->IsIntersectedByRay(pixelPosition, dirVox, infDist, supDist);
+    bool                 isIntersectByRay = false;
+    if (m_RayTable.IsNotNull())
+    {
+      const JosephRayTable::Ray & ray = m_RayTable->GetRay(itOut.GetIndex());
+      infDist = ray.InfDist;
+      supDist = ray.SupDist;
+      isIntersectByRay = infDist <= supDist;
+    }
+    else
+      isIntersectByRay = box->IsIntersectedByRay(pixelPosition, dirVox, infDist, supDist);
     // Clip the casting between source and pixel of the detector
     infDist = std::max(infDist, inferiorClip);
     supDist = std::min(supDist, superiorClip);
@@ -0,0 +1,249 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkJosephRayTable_h
+#define rtkJosephRayTable_h
+
+#include "rtkBoxShape.h"
+#include "rtkProjectionsRegionConstIteratorRayBased.h"
+#include "rtkThreeDCircularProjectionGeometry.h"
+
+#include <itkMultiThreaderBase.h>
+#include <itkObject.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace rtk
+{
+
+/** \class JosephRayTable
+ * \brief Table of the intersections of the rays with the volume box shared by
+ * the Joseph projectors.
+ *
+ * rtk::JosephForwardProjectionImageFilter and
+ * rtk::JosephBackProjectionImageFilter intersect each ray, from a detector
+ * pixel to the source, with the box of the volume before traversing it. In
+ * iterative reconstruction, the geometry and the volume do not change between
+ * iterations so these intersections can be computed once and reused by both
+ * projectors if they are given the same table with SetRayTable.
+ *
+ * The table stores, for each pixel of the projections, the distances of
+ * BoxShape::IsIntersectedByRay before clipping. It is filled lazily, one
+ * projection at a time, so that projectors processing subsets of projections
+ * only compute the rays they need. The table is emptied if the geometry, the
+ * volume box, the volume to index transform or the detector region change.
+ * The forward projector uses the box of the buffered region of its volume and
+ * the back projector the box of the requested region of its output. Sharing
+ * the table is therefore only useful if both are the same, i.e., if the volume
+ * is not streamed, otherwise the table is recomputed each time the other
+ * projector uses it.
+ *
+ * The distances are stored in single precision, rounded towards the inside
+ * of the box. The table uses 8 bytes per pixel of the projections once all
+ * projections have been processed, e.g., 2 GB for 1000 projections of
+ * 512x512 pixels, in addition to the projections themselves.
+ *
+ * \ingroup RTK Projector
+ */
+class JosephRayTable : public itk::Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(JosephRayTable);
+
+  /** Standard class type alias. */
+  using Self = JosephRayTable;
+  using Superclass = itk::Object;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  /** Convenient type alias. */
+  using GeometryType = ThreeDCircularProjectionGeometry;
+  using MatrixType = GeometryType::ThreeDHomogeneousMatrixType;
+  using RegionType = itk::ImageRegion<3>;
+  using IndexType = itk::Index<3>;
+  using PointType = itk::Point<double, 3>;
+  using SpacingType = itk::Vector<double, 3>;
+  using DirectionType = itk::Matrix<double, 3, 3>;
+
+  /** Intersection of one ray with the box. Rays which do not intersect the box
+   * have InfDist > SupDist. */
+  struct Ray
+  {
+    float InfDist;
+    float SupDist;
+  };
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkOverrideGetNameOfClassMacro(JosephRayTable);
+
+  /** Compute the rays of the projections of region which are not in the
+   * table yet. volPPToIndex and box are those used by the projector. */
+  template <class TProjectionImage>
+  void
+  Update(const TProjectionImage * projections,
+         const RegionType &       region,
+         const GeometryType *     geometry,
+         const MatrixType &       volPPToIndex,
+         const BoxShape *         box,
+         itk::MultiThreaderBase * multiThreader);
+
+  /** Ray of a pixel of the region passed to the last call to Update. */
+  const Ray &
+  GetRay(const IndexType & index) const
+  {
+    return m_Rays[index[2]][(index[1] - m_Index[1]) * m_Size[0] + index[0] - m_Index[0]];
+  }
+
+  /** Empty the table. */
+  void
+  Clear()
+  {
+    m_Rays.clear();
+    m_Geometry = nullptr;
+  }
+
+protected:
+  JosephRayTable() = default;
+  ~JosephRayTable() override = default;
+
+private:
+  /** One vector of rays per projection of the geometry, empty if the
+   * projection has not been computed yet. */
+  std::vector<std::vector<Ray>> m_Rays;
+
+  /** Parameters the rays depend on */
+  const GeometryType *  m_Geometry{ nullptr };
+  itk::ModifiedTimeType m_GeometryMTime{ 0 };
+  MatrixType            m_VolPPToIndex;
+  BoxShape::PointType   m_BoxMin;
+  BoxShape::PointType   m_BoxMax;
+  itk::Index<2>         m_Index{ { 0, 0 } };
+  itk::Size<2>          m_Size{ { 0, 0 } };
+  PointType             m_Origin;
+  SpacingType           m_Spacing;
+  DirectionType         m_Direction;
+};
+
+template <class TProjectionImage>
+void
+JosephRayTable::Update(const TProjectionImage * projections,
+                       const RegionType &       region,
+                       const GeometryType *     geometry,
+                       const MatrixType &       volPPToIndex,
+                       const BoxShape *         box,
+                       itk::MultiThreaderBase * multiThreader)
+{
+  // Empty the table if the rays have changed
+  PointType     origin;
+  SpacingType   spacing;
+  DirectionType direction;
+  for (unsigned int i = 0; i < 3; i++)
+  {
+    origin[i] = projections->GetOrigin()[i];
+    spacing[i] = projections->GetSpacing()[i];
+    for (unsigned int j = 0; j < 3; j++)
+      direction[i][j] = projections->GetDirection()[i][j];
+  }
+  if (geometry != m_Geometry || geometry->GetMTime() != m_GeometryMTime || volPPToIndex != m_VolPPToIndex ||
+      box->GetBoxMin() != m_BoxMin || box->GetBoxMax() != m_BoxMax || region.GetIndex(0) != m_Index[0] ||
+      region.GetIndex(1) != m_Index[1] || region.GetSize(0) != m_Size[0] || region.GetSize(1) != m_Size[1] ||
+      origin != m_Origin || spacing != m_Spacing || direction != m_Direction)
+  {
+    m_Rays.clear();
+    m_Rays.resize(geometry->GetGantryAngles().size());
+    m_Geometry = geometry;
+    m_GeometryMTime = geometry->GetMTime();
+    m_VolPPToIndex = volPPToIndex;
+    m_BoxMin = box->GetBoxMin();
+    m_BoxMax = box->GetBoxMax();
+    for (unsigned int i = 0; i < 2; i++)
+    {
+      m_Index[i] = region.GetIndex(i);
+      m_Size[i] = region.GetSize(i);
+    }
+    m_Origin = origin;
+    m_Spacing = spacing;
+    m_Direction = direction;
+    this->Modified();
+  }
+
+  // Projections of the region which are not in the table yet
+  std::vector<unsigned int> missing;
+  for (itk::IndexValueType p = region.GetIndex(2); p < region.GetIndex(2) + (itk::IndexValueType)region.GetSize(2); p++)
+    if (m_Rays[p].empty())
+      missing.push_back(p);
+  if (missing.empty())
+    return;
+
+  multiThreader->ParallelizeArray(
+    0,
+    missing.size(),
+    [&](itk::SizeValueType k) {
+      RegionType projRegion = region;
+      projRegion.SetIndex(2, missing[k]);
+      projRegion.SetSize(2, 1);
+      const unsigned int nPixels = projRegion.GetNumberOfPixels();
+
+      using IteratorType = ProjectionsRegionConstIteratorRayBased<TProjectionImage>;
+      IteratorType *                    it = IteratorType::New(projections, projRegion, geometry, volPPToIndex);
+      std::vector<BoxShape::PointType>  pixelPositions(nPixels);
+      std::vector<BoxShape::VectorType> dirVox(nPixels);
+      for (unsigned int pix = 0; pix < nPixels; pix++, it->Next())
+      {
+        pixelPositions[pix] = it->GetPixelPosition();
+        dirVox[pix] = -it->GetSourceToPixel();
+      }
+      delete it;
+
+      std::vector<BoxShape::ScalarType> infDist(nPixels), supDist(nPixels);
+      std::unique_ptr<bool[]>           intersected(new bool[nPixels]);
+      box->AreIntersectedByRays(
+        pixelPositions.data(), dirVox.data(), nPixels, infDist.data(), supDist.data(), intersected.get());
+
+      std::vector<Ray> & rays = m_Rays[missing[k]];
+      rays.resize(nPixels);
+      for (unsigned int pix = 0; pix < nPixels; pix++)
+      {
+        if (intersected[pix])
+        {
+          // Round towards the inside of the box so that the intersection
+          // points remain in the volume
+          float inf = static_cast<float>(infDist[pix]);
+          float sup = static_cast<float>(supDist[pix]);
+          if (inf < infDist[pix])
+            inf = std::nextafter(inf, std::numeric_limits<float>::max());
+          if (sup > supDist[pix])
+            sup = std::nextafter(sup, std::numeric_limits<float>::lowest());
+          rays[pix] = { inf, sup };
+        }
+        else
+          rays[pix] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() };
+      }
+    },
+    nullptr);
+}
+
+} // end namespace rtk
+
+#endif
@@ -18,8 +18,9 @@
 #ifndef rtkLastDimensionL0GradientDenoisingImageFilter_hxx
 #define rtkLastDimensionL0GradientDenoisingImageFilter_hxx
 
-#include "itkImageRegionIteratorWithIndex.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+
+#include <vector>
 
 namespace rtk
 {
@@ -73,73 +74,56 @@ LastDimensionL0GradientDenoisingImageFilter<TInputImage>::OneDimensionMinimizeL0
                                                                                                double           lambda,
                                                                                                unsigned int     nbIters)
 {
-  // Initialize
+  // Initialize. The groups are contiguous and ordered, so the first element of
+  // a group is the sum of the weights of the groups before it.
   float                       beta = 0;
-  std::vector<unsigned int>   firsts(length);
-  std::vector<float>          weights(length);
-  std::vector<InputPixelType> values(length);
+  std::vector<float>          weights(length, 1.0);
+  std::vector<InputPixelType> values(input, input + length);
   unsigned int                nbGroups = length;
 
-  // Fill in the arrays
-  for (unsigned int i = 0; i < length; i++)
-  {
-    firsts[i] = i;
-    weights[i] = 1.0;
-    values[i] = input[i];
-  }
-
   // Main loop
   for (unsigned int iter = 0; iter < nbIters; iter++)
   {
     // Set the threshold for the current iteration (beta increases over time towards lambda)
     beta = (float)iter / (float)nbIters * lambda;
 
-    // Run through all groups
+    // Run through all groups, merging each group with its right neighbour if
+    // the gain is below beta. A merged group is not compared again during this
+    // pass. Merged groups are compacted in place (w <= i) so that a pass is
+    // linear in the number of groups.
     unsigned int i = 0;
-    while (i < nbGroups - 1)
+    unsigned int w = 0;
+    while (i < nbGroups)
     {
-      // Check the right neighbour of the current group
-      unsigned int j = (i + 1) % nbGroups;
-
-      // Decide whether or not to merge the current group with its right neighbour
-      if (weights[i] * weights[j] * (values[i] - values[j]) * (values[i] - values[j]) <=
-          beta * (weights[i] + weights[j]))
+      const unsigned int j = i + 1;
+      if (j < nbGroups && weights[i] * weights[j] * (values[i] - values[j]) * (values[i] - values[j]) <=
+                            beta * (weights[i] + weights[j]))
       {
-        // Perform the fusion
-
         // The merged group's value is the weighted mean between the values of both groups
-        values[i] = (weights[i] * values[i] + weights[j] * values[j]) / (weights[i] + weights[j]);
-
-        // The merged group's weight is the sum of the weights of both groups
-        weights[i] = weights[i] + weights[j];
-
-        // Remove j-th element by shifting everything after it
-        for (unsigned int k = j + 1; k < length; k++)
-        {
-          firsts[k - 1] = firsts[k];
-          values[k - 1] = values[k];
-          weights[k - 1] = weights[k];
-        }
-        firsts[length - 1] = 0;
-        values[length - 1] = 0;
-        weights[length - 1] = 0;
-
-        // Decrement the total number of groups
-        nbGroups--;
+        // and its weight is the sum of the weights of both groups
+        values[w] = (weights[i] * values[i] + weights[j] * values[j]) / (weights[i] + weights[j]);
+        weights[w] = weights[i] + weights[j];
+        i += 2;
       }
-
-      // Move to next group
-      i++;
+      else
+      {
+        values[w] = values[i];
+        weights[w] = weights[i];
+        i++;
+      }
+      w++;
     }
+    nbGroups = w;
   }
 
   // Assemble the pieces to create the denoised output (overwriting the input)
-  for (unsigned int i = 0; i < nbGroups; i++)
+  unsigned int first = 0;
+  for (unsigned int g = 0; g < nbGroups; g++)
   {
-    for (unsigned int j = firsts[i]; j < firsts[i] + weights[i]; j++)
-    {
-      input[j % length] = values[i];
-    }
+    const auto last = static_cast<unsigned int>(first + weights[g]);
+    for (unsigned int k = first; k < last; k++)
+      input[k] = values[g];
+    first = last;
   }
 }
 
@@ -150,64 +134,36 @@ LastDimensionL0GradientDenoisingImageFilter<TInputImage>::ThreadedGenerateData(
   itk::ThreadIdType                        itkNotUsed(threadId))
 {
   // Walks the first frame of the outputRegionForThread
-  // For each voxel, creates an input iterator that walks
-  // the last dimension and computes the average, and
-  // a similar output iterator that replaces the output
-  // by their average along last dimension if ROI=1
+  // For each voxel, copies the values along the last dimension
+  // in a buffer, regularizes it and writes it back in the output
+  constexpr unsigned int Dimension = TInputImage::ImageDimension - 1;
 
   // Create a region containing only the first frame of outputRegionForThread
   typename TInputImage::RegionType FirstFrameRegion = outputRegionForThread;
-  FirstFrameRegion.SetSize(TInputImage::ImageDimension - 1, 1);
+  FirstFrameRegion.SetSize(Dimension, 1);
+  itk::ImageRegionConstIteratorWithIndex<TInputImage> FakeIterator(this->GetOutput(), FirstFrameRegion);
 
-  // Iterate on this region
-  itk::ImageRegionIteratorWithIndex<TInputImage> FakeIterator(this->GetOutput(), FirstFrameRegion);
+  // The values of a voxel along the last dimension are one frame apart in memory
+  const unsigned int          length = outputRegionForThread.GetSize(Dimension);
+  const itk::OffsetValueType  inputStride = this->GetInput()->GetOffsetTable()[Dimension];
+  const itk::OffsetValueType  outputStride = this->GetOutput()->GetOffsetTable()[Dimension];
+  std::vector<InputPixelType> toBeRegularized(length);
 
-  // Create a single-voxel region traversing last dimension
-  typename TInputImage::RegionType SingleVoxelRegion = outputRegionForThread;
-  for (unsigned int dim = 0; dim < TInputImage::ImageDimension - 1; dim++)
+  for (; !FakeIterator.IsAtEnd(); ++FakeIterator)
   {
-    SingleVoxelRegion.SetSize(dim, 1);
-    SingleVoxelRegion.SetIndex(dim, 0);
-  }
-
-  while (!FakeIterator.IsAtEnd())
-  {
-    // Configure the SingleVoxelRegion correctly to follow the FakeIterator
-    // It is the only purpose of this FakeIterator
-    SingleVoxelRegion.SetIndex(FakeIterator.GetIndex());
-
-    // Walk the input along last dimension for this voxel, filling an array with the values read
-    itk::ImageRegionConstIterator<TInputImage> inputIterator(this->GetInput(), SingleVoxelRegion);
-    auto * toBeRegularized = new InputPixelType[outputRegionForThread.GetSize(TInputImage::ImageDimension - 1)];
-
-    unsigned int i = 0;
-    while (!inputIterator.IsAtEnd())
-    {
-      toBeRegularized[i] = inputIterator.Get();
-      i++;
-      ++inputIterator;
-    }
+    const InputPixelType * in =
+      this->GetInput()->GetBufferPointer() + this->GetInput()->ComputeOffset(FakeIterator.GetIndex());
+    for (unsigned int i = 0; i < length; i++)
+      toBeRegularized[i] = in[i * inputStride];
 
     // Perform regularization (in place) on this array
-    OneDimensionMinimizeL0NormOfGradient(toBeRegularized,
-                                         outputRegionForThread.GetSize(TInputImage::ImageDimension - 1),
-                                         this->GetLambda(),
-                                         this->GetNumberOfIterations());
-
-    // Walk the output along last dimension for this voxel,
-    // replacing voxel with their regularized value
-    itk::ImageRegionIterator<TInputImage> outputIterator(this->GetOutput(), SingleVoxelRegion);
-    i = 0;
-    while (!outputIterator.IsAtEnd())
-    {
-      outputIterator.Set(toBeRegularized[i]);
-      i++;
-      ++outputIterator;
-    }
-
-    delete[] toBeRegularized;
+    OneDimensionMinimizeL0NormOfGradient(
+      toBeRegularized.data(), length, this->GetLambda(), this->GetNumberOfIterations());
 
-    ++FakeIterator;
+    InputPixelType * out =
+      this->GetOutput()->GetBufferPointer() + this->GetOutput()->ComputeOffset(FakeIterator.GetIndex());
+    for (unsigned int i = 0; i < length; i++)
+      out[i * outputStride] = toBeRegularized[i];
   }
 }
 
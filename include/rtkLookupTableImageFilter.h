@@ -19,9 +19,10 @@
 #ifndef rtkLookupTableImageFilter_h
 #define rtkLookupTableImageFilter_h
 
-#include <itkLinearInterpolateImageFunction.h>
 #include <itkUnaryFunctorImageFilter.h>
 
+#include <algorithm>
+
 namespace rtk
 {
 
@@ -31,7 +32,8 @@ namespace rtk
  * The lookup table is a 1D image. Two cases:
  * - if the pixel type is float or double, the meta information of the image
  * (spacing and origin) is used to select the pixel position and interpolate
- * linearly at this position.
+ * linearly at this position. Positions outside the table are clamped to its
+ * first and last values.
  * - otherwise, it reads the value at the integer position, without
  * interpolation.
  *
@@ -50,12 +52,9 @@ public:
   using LookupTableType = itk::Image<TOutput, 1>;
   using LookupTablePointer = typename LookupTableType::Pointer;
   using LookupTableDataPointer = typename LookupTableType::PixelType *;
-  using InterpolatorType = typename itk::LinearInterpolateImageFunction<LookupTableType, double>;
-  using InterpolatorPointer = typename InterpolatorType::Pointer;
 
   LUT()
-    : m_LookupTableDataPointer(nullptr)
-    , m_Interpolator(InterpolatorType::New()) {};
+    : m_LookupTableDataPointer(nullptr) {};
   ~LUT() = default;
 
   /** Get/Set the lookup table. */
@@ -70,7 +69,8 @@ public:
     m_LookupTablePointer = lut;
     m_LookupTableDataPointer = lut->GetBufferPointer();
     m_InverseLUTSpacing = 1. / m_LookupTablePointer->GetSpacing()[0];
-    m_Interpolator->SetInputImage(lut);
+    m_LUTOrigin = lut->GetOrigin()[0] + lut->GetBufferedRegion().GetIndex(0) * lut->GetSpacing()[0];
+    m_LUTLastIndex = std::max(static_cast<double>(lut->GetBufferedRegion().GetSize(0)) - 1., 0.);
   }
 
   [[nodiscard]] LookupTableDataPointer
@@ -94,10 +94,26 @@ public:
   operator()(const TInput & val) const;
 
 private:
+  /** Linear interpolation in the buffer of the lookup table at the physical
+   * position val, equivalent to itk::LinearInterpolateImageFunction but
+   * inlined in the pixel loop. */
+  inline double
+  Interpolate(const double val) const
+  {
+    const double index = std::clamp(m_InverseLUTSpacing * (val - m_LUTOrigin), 0., m_LUTLastIndex);
+    const auto   base = static_cast<itk::SizeValueType>(index);
+    const double distance = index - base;
+    const double val0 = m_LookupTableDataPointer[base];
+    if (distance <= 0.)
+      return val0;
+    return val0 + (m_LookupTableDataPointer[base + 1] - val0) * distance;
+  }
+
   LookupTablePointer     m_LookupTablePointer;
   LookupTableDataPointer m_LookupTableDataPointer;
-  InterpolatorPointer    m_Interpolator;
   double                 m_InverseLUTSpacing{};
+  double                 m_LUTOrigin{};
+  double                 m_LUTLastIndex{};
 };
 
 template <class TInput, class TOutput>
@@ -111,18 +127,14 @@ template <>
 inline float
 LUT<float, float>::operator()(const float & val) const
 {
-  InterpolatorType::ContinuousIndexType index;
-  index[0] = m_InverseLUTSpacing * (val - m_LookupTablePointer->GetOrigin()[0]);
-  return static_cast<float>(m_Interpolator->EvaluateAtContinuousIndex(index));
+  return static_cast<float>(Interpolate(val));
 }
 
 template <>
 inline double
 LUT<double, double>::operator()(const double & val) const
 {
-  InterpolatorType::ContinuousIndexType index;
-  index[0] = m_InverseLUTSpacing * (val - m_LookupTablePointer->GetOrigin()[0]);
-  return static_cast<double>(m_Interpolator->EvaluateAtContinuousIndex(index));
+  return Interpolate(val);
 }
 
 } // end namespace Functor
@@ -136,6 +148,11 @@ LUT<double, double>::operator()(const double & val) const
  * information of the lookup table (origin and spacing) to locate a continuous
  * index and interpolate at the corresponding location.
  *
+ * With integer input pixels, each line of the output region is processed with
+ * a plain loop over the buffers of the input, the output and the lookup table
+ * which the compiler can vectorize. The lookup table must then cover all the
+ * values of the input, e.g., 65536 values for unsigned short images.
+ *
  * \author Simon Rit
  *
  * \ingroup RTK ImageToImageFilter
@@ -189,6 +206,10 @@ public:
   void
   BeforeThreadedGenerateData() override;
 
+  /** Direct indexing of the lookup table for integer inputs. */
+  void
+  DynamicThreadedGenerateData(const typename TOutputImage::RegionType & outputRegionForThread) override;
+
 protected:
   LookupTableImageFilter() = default;
   ~LookupTableImageFilter() override = default;
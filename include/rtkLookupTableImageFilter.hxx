@@ -19,6 +19,9 @@
 #ifndef rtkLookupTableImageFilter_hxx
 #define rtkLookupTableImageFilter_hxx
 
+#include <itkImageScanlineIterator.h>
+
+#include <type_traits>
 
 namespace rtk
 {
@@ -32,6 +35,42 @@ LookupTableImageFilter<TInputImage, TOutputImage>::BeforeThreadedGenerateData()
   this->SetLookupTable(m_LookupTable);
 }
 
+template <class TInputImage, class TOutputImage>
+void
+LookupTableImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
+  const typename TOutputImage::RegionType & outputRegionForThread)
+{
+  using InputPixelType = typename TInputImage::PixelType;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  if constexpr (!std::is_integral_v<InputPixelType>)
+  {
+    Superclass::DynamicThreadedGenerateData(outputRegionForThread);
+  }
+  else
+  {
+    const TInputImage * inputPtr = this->GetInput();
+    TOutputImage *      outputPtr = this->GetOutput(0);
+
+    typename TInputImage::RegionType inputRegionForThread;
+    this->CallCopyOutputRegionToInputRegion(inputRegionForThread, outputRegionForThread);
+
+    const OutputPixelType * lut = this->m_LookupTable->GetBufferPointer();
+    const auto              lineLength = outputRegionForThread.GetSize(0);
+
+    itk::ImageScanlineConstIterator<TInputImage> inputIt(inputPtr, inputRegionForThread);
+    itk::ImageScanlineIterator<TOutputImage>     outputIt(outputPtr, outputRegionForThread);
+    while (!inputIt.IsAtEnd())
+    {
+      const InputPixelType * in = &(inputIt.Value());
+      OutputPixelType *      out = &(outputIt.Value());
+      for (itk::SizeValueType i = 0; i < lineLength; i++)
+        out[i] = lut[in[i]];
+      inputIt.NextLine();
+      outputIt.NextLine();
+    }
+  }
+}
+
 } // namespace rtk
 
 #endif
@@ -187,6 +187,7 @@
  * If output-every argument is provided, save intermediate output in a file.
  * If iteration-file-name is provided, the intermediate output is saved in a file
  * having custom name and location.
+ * If tracing is on in GlobalResourceProbe, the iterations are recorded in the trace.
  *
  * \author Aurélien Coussat
  *
@@ -213,6 +214,12 @@
       outputIterationCommand->SetFileFormat("iter%d.mha");                                      \
     }                                                                                           \
     filter->AddObserver(itk::IterationEvent(), outputIterationCommand);                         \
+  }                                                                                             \
+  if (rtk::GlobalResourceProbe::GetInstance()->GetTracing())                                    \
+  {                                                                                             \
+    using TraceIterationCommandType = rtk::TraceIterationCommand<filter_type>;                  \
+    auto traceIterationCommand = TraceIterationCommandType::New();                              \
+    filter->AddObserver(itk::AnyEvent(), traceIterationCommand);                                \
   }
 //--------------------------------------------------------------------
 
@@ -34,6 +34,74 @@
 
 namespace rtk
 {
+namespace Functor
+{
+
+/** \class ProjectedValueRatio
+ * \brief Replaces the input of the Joseph forward projector, the measured
+ * projection, by its ratio to the ray cast value.
+ *
+ * The ratio follows itk::DivideOrZeroOutImageFilter with a constant of 1:
+ * estimated values lower than 1e-5 give a ratio of 1.
+ *
+ * \ingroup RTK Functions
+ */
+template <class TInput, class TOutput>
+class ITK_TEMPLATE_EXPORT ProjectedValueRatio : public ProjectedValueAccumulation<TInput, TOutput>
+{
+public:
+  using VectorType = itk::Vector<double, 3>;
+  using PointType = itk::Point<double, 3>;
+
+  void
+  operator()(const ThreadIdType itkNotUsed(threadId),
+             const TInput &     input,
+             TOutput &          output,
+             const TOutput &    rayCastValue,
+             const VectorType & stepInMM,
+             const PointType &  itkNotUsed(source),
+             const VectorType & itkNotUsed(sourceToPixel),
+             const PointType &  itkNotUsed(nearestPoint),
+             const PointType &  itkNotUsed(farthestPoint)) const
+  {
+    const TOutput estimate = rayCastValue * stepInMM.GetNorm();
+    output = (estimate < 1e-5) ? TOutput(1) : static_cast<TOutput>(input / estimate);
+  }
+};
+
+/** \class ProjectedValueRatioAttenuated
+ * \brief Same as ProjectedValueRatio for the attenuated Joseph forward
+ * projector.
+ *
+ * \ingroup RTK Functions
+ */
+template <class TInput, class TOutput>
+class ITK_TEMPLATE_EXPORT ProjectedValueRatioAttenuated : public ProjectedValueAccumulationAttenuated<TInput, TOutput>
+{
+public:
+  using Superclass = ProjectedValueAccumulationAttenuated<TInput, TOutput>;
+  using VectorType = itk::Vector<double, 3>;
+  using PointType = itk::Point<double, 3>;
+
+  void
+  operator()(const ThreadIdType threadId,
+             const TInput &     input,
+             TOutput &          output,
+             const TOutput &    rayCastValue,
+             const VectorType & stepInMM,
+             const PointType &  source,
+             const VectorType & sourceToPixel,
+             const PointType &  nearestPoint,
+             const PointType &  farthestPoint)
+  {
+    TOutput estimate;
+    Superclass::operator()(
+      threadId, TInput(0), estimate, rayCastValue, stepInMM, source, sourceToPixel, nearestPoint, farthestPoint);
+    output = (estimate < 1e-5) ? TOutput(1) : static_cast<TOutput>(input / estimate);
+  }
+};
+
+} // end namespace Functor
 
 /** \class OSEMConeBeamReconstructionFilter
  * \brief Implements the Ordered-Subset Expectation-Maximization algorithm.
@@ -143,6 +211,7 @@ public:
   using DePierroRegularizationFilterType = rtk::DePierroRegularizationImageFilter<VolumeType, VolumeType>;
 
   using ForwardProjectionType = typename Superclass::ForwardProjectionType;
+  using ForwardProjectionPointerType = typename Superclass::ForwardProjectionPointerType;
   using BackProjectionType = typename Superclass::BackProjectionType;
 
   /** Standard New method. */
@@ -198,6 +267,57 @@ protected:
   VerifyInputInformation() const override
   {}
 
+  /** Instantiates a forward projector which outputs the ratio of its input 0,
+   * the measured projections, to the forward projection of its input 1, or
+   * returns nullptr if the projector type does not support it. */
+  template <typename ImageType, typename Superclass::template EnableVectorType<ImageType> * = nullptr>
+  ForwardProjectionPointerType
+  InstantiateRatioForwardProjectionFilter(int itkNotUsed(fwtype))
+  {
+    return nullptr;
+  }
+
+  template <typename ImageType, typename Superclass::template DisableVectorType<ImageType> * = nullptr>
+  ForwardProjectionPointerType
+  InstantiateRatioForwardProjectionFilter(int fwtype)
+  {
+    using InputPixelType = typename VolumeType::PixelType;
+    using OutputPixelType = typename ImageType::PixelType;
+    using ValueType = typename itk::PixelTraits<InputPixelType>::ValueType;
+    using WeightMultiplicationType = Functor::InterpolationWeightMultiplication<InputPixelType, ValueType>;
+    using RatioType = Functor::ProjectedValueRatio<InputPixelType, OutputPixelType>;
+    if (fwtype == Superclass::FP_JOSEPH)
+    {
+      auto fw = JosephForwardProjectionImageFilter<VolumeType, ImageType, WeightMultiplicationType, RatioType>::New();
+      if (this->GetSuperiorClipImage().IsNotNull())
+        fw->SetSuperiorClipImage(this->GetSuperiorClipImage());
+      if (this->GetInferiorClipImage().IsNotNull())
+        fw->SetInferiorClipImage(this->GetInferiorClipImage());
+      if (this->GetUseJosephRayTable())
+        fw->SetRayTable(this->GetJosephRayTable());
+      return fw.GetPointer();
+    }
+    if (fwtype == Superclass::FP_JOSEPHATTENUATED)
+    {
+      if (this->GetAttenuationMap().IsNull())
+        itkExceptionMacro(<< "Set Joseph attenuated forward projection filter but no attenuation map is given");
+      auto fw = JosephForwardAttenuatedProjectionImageFilter<
+        VolumeType,
+        ImageType,
+        Functor::InterpolationWeightMultiplicationAttenuated<InputPixelType, ValueType>,
+        Functor::ProjectedValueRatioAttenuated<InputPixelType, OutputPixelType>>::New();
+      fw->SetInput(2, this->GetAttenuationMap());
+      if (this->GetSuperiorClipImage().IsNotNull())
+        fw->SetSuperiorClipImage(this->GetSuperiorClipImage());
+      if (this->GetInferiorClipImage().IsNotNull())
+        fw->SetInferiorClipImage(this->GetInferiorClipImage());
+      if (this->GetUseJosephRayTable())
+        fw->SetRayTable(this->GetJosephRayTable());
+      return fw.GetPointer();
+    }
+    return nullptr;
+  }
+
   /** Pointers to each subfilter of this composite filter */
   typename ExtractFilterType::Pointer                m_ExtractFilter;
   typename ForwardProjectionFilterType::Pointer      m_ForwardProjectionFilter;
@@ -226,6 +346,10 @@ private:
 
   bool m_StoreNormalizationImages{ true };
 
+  /** True if the forward projector directly outputs the ratio of the measured
+   * to the forward projected values. */
+  bool m_FusedRatio{ false };
+
 }; // end of class
 
 } // end namespace rtk
@@ -88,8 +88,13 @@ OSEMConeBeamReconstructionFilter<TVolumeImage, TProjectionImage>::GenerateOutput
   // requested in the GenerateData function
   typename ExtractFilterType::InputImageRegionType projRegion;
 
-  // Set forward projection filter
-  m_ForwardProjectionFilter = this->InstantiateForwardProjectionFilter(this->m_CurrentForwardProjectionConfiguration);
+  // Set forward projection filter, computing the ratio to the measured
+  // projections in its ray loop when possible
+  m_ForwardProjectionFilter = this->template InstantiateRatioForwardProjectionFilter<TProjectionImage>(
+    this->m_CurrentForwardProjectionConfiguration);
+  m_FusedRatio = m_ForwardProjectionFilter.IsNotNull();
+  if (!m_FusedRatio)
+    m_ForwardProjectionFilter = this->InstantiateForwardProjectionFilter(this->m_CurrentForwardProjectionConfiguration);
 
   // Set back projection filter
   m_BackProjectionFilter = this->InstantiateBackProjectionFilter(this->m_CurrentBackProjectionConfiguration);
@@ -116,7 +121,10 @@ OSEMConeBeamReconstructionFilter<TVolumeImage, TProjectionImage>::GenerateOutput
   m_ZeroConstantProjectionStackSource->SetConstant(0);
 
   m_BackProjectionFilter->SetInput(0, m_ConstantVolumeSource->GetOutput());
-  m_BackProjectionFilter->SetInput(1, m_DivideProjectionFilter->GetOutput());
+  if (m_FusedRatio)
+    m_BackProjectionFilter->SetInput(1, m_ForwardProjectionFilter->GetOutput());
+  else
+    m_BackProjectionFilter->SetInput(1, m_DivideProjectionFilter->GetOutput());
   m_BackProjectionFilter->SetTranspose(false);
 
   m_BackProjectionNormalizationFilter->SetInput(0, m_ConstantVolumeSource->GetOutput());
@@ -133,11 +141,18 @@ OSEMConeBeamReconstructionFilter<TVolumeImage, TProjectionImage>::GenerateOutput
   m_DivideVolumeFilter->SetInput2(m_DePierroRegularizationFilter->GetOutput());
   m_DivideVolumeFilter->SetConstant(0);
 
-  m_ForwardProjectionFilter->SetInput(0, m_ZeroConstantProjectionStackSource->GetOutput());
   m_ForwardProjectionFilter->SetInput(1, this->GetInput(0));
-
-  m_DivideProjectionFilter->SetInput2(m_ForwardProjectionFilter->GetOutput());
-  m_DivideProjectionFilter->SetConstant(1);
+  if (m_FusedRatio)
+  {
+    // The forward projector runs in place on the extracted measured projections
+    m_ForwardProjectionFilter->SetInput(0, m_ExtractFilter->GetOutput());
+  }
+  else
+  {
+    m_ForwardProjectionFilter->SetInput(0, m_ZeroConstantProjectionStackSource->GetOutput());
+    m_DivideProjectionFilter->SetInput2(m_ForwardProjectionFilter->GetOutput());
+    m_DivideProjectionFilter->SetConstant(1);
+  }
 
   m_ForwardProjectionFilter->SetGeometry(this->m_Geometry);
   m_BackProjectionFilter->SetGeometry(this->m_Geometry);
@@ -199,8 +214,9 @@ OSEMConeBeamReconstructionFilter<TVolumeImage, TProjectionImage>::GenerateData()
       m_ExtractFilter->SetExtractionRegion(subsetRegion);
       m_ExtractFilter->UpdateOutputInformation();
 
-      m_ZeroConstantProjectionStackSource->SetInformationFromImage(
-        const_cast<TProjectionImage *>(m_ExtractFilter->GetOutput()));
+      if (!m_FusedRatio)
+        m_ZeroConstantProjectionStackSource->SetInformationFromImage(
+          const_cast<TProjectionImage *>(m_ExtractFilter->GetOutput()));
 
       // This is required to reset the full pipeline
       m_BackProjectionFilter->GetOutput()->UpdateOutputInformation();
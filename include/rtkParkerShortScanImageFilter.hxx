@@ -180,12 +180,18 @@ ParkerShortScanImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDa
       double       alpha = atan(-1 * l * invsid);
       const double pi = itk::Math::pi;
       if (beta <= 2 * m_Delta - 2 * alpha)
-        itWeights.Set(2. * pow(sin((pi * beta) / (4 * (m_Delta - alpha))), 2.));
+      {
+        const double s = sin((pi * beta) / (4 * (m_Delta - alpha)));
+        itWeights.Set(2. * s * s);
+      }
       else if (beta <= pi - 2 * alpha)
         itWeights.Set(2.);
       else if (beta <= pi + 2 * m_Delta)
+      {
         // Denominator fix to a typo in equation (12) of Parker's article.
-        itWeights.Set(2. * pow(sin((pi * (pi + 2 * m_Delta - beta)) / (4 * (m_Delta + alpha))), 2.));
+        const double s = sin((pi * (pi + 2 * m_Delta - beta)) / (4 * (m_Delta + alpha)));
+        itWeights.Set(2. * s * s);
+      }
       else
         itWeights.Set(0.);
 
@@ -19,9 +19,10 @@
 #ifndef rtkProjectGeometricPhantomImageFilter_h
 #define rtkProjectGeometricPhantomImageFilter_h
 
+#include "rtkConvexShapeBoundingVolumeHierarchy.h"
 #include "rtkGeometricPhantom.h"
-#include "rtkThreeDCircularProjectionGeometry.h"
 #include <itkAddImageFilter.h>
+#include "rtkThreeDCircularProjectionGeometry.h"
 #include <itkInPlaceImageFilter.h>
 
 namespace rtk
@@ -30,6 +31,14 @@ namespace rtk
 /** \class ProjectGeometricPhantomImageFilter
  * \brief Analytical projection a GeometricPhantom
  *
+ * All shapes are projected in a single pass over the projections. Rays are
+ * processed by packets of 16 consecutive pixels: the shapes which may be
+ * intersected by the rays of a packet are selected with a
+ * ConvexShapeBoundingVolumeHierarchy and each of them is intersected with the
+ * whole packet with ConvexShape::AreIntersectedByRays. Contributions are
+ * added in the order of the phantom, as RayConvexIntersectionImageFilter would
+ * do shape by shape.
+ *
  * \test rtkprojectgeometricphantomtest.cxx, rtkforbildtest.cxx
  *
  * \author Marc Vila, Simon Rit
@@ -56,6 +65,7 @@ public:
   using VectorType = ConvexShape::VectorType;
   using RotationMatrixType = ConvexShape::RotationMatrixType;
   using ScalarType = ConvexShape::ScalarType;
+  using OutputImageRegionType = typename TOutputImage::RegionType;
 
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
@@ -110,8 +120,12 @@ protected:
   void
   VerifyPreconditions() const override;
 
+  /** Reads the phantom and builds the hierarchy of its transformed shapes. */
   void
-  GenerateData() override;
+  BeforeThreadedGenerateData() override;
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
   GeometricPhantomConstPointer m_GeometricPhantom;
@@ -122,6 +136,8 @@ private:
   RotationMatrixType           m_RotationMatrix;
   std::vector<VectorType>      m_PlaneDirections;
   std::vector<ScalarType>      m_PlanePositions;
+
+  ConvexShapeBoundingVolumeHierarchy m_Hierarchy;
 };
 
 } // end namespace rtk
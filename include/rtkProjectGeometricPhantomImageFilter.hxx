@@ -20,8 +20,12 @@
 #define rtkProjectGeometricPhantomImageFilter_hxx
 
 #include "rtkForbildPhantomFileReader.h"
-#include "rtkRayConvexIntersectionImageFilter.h"
+#include "rtkProjectionsRegionConstIteratorRayBased.h"
 
+#include <itkImageRegionIterator.h>
+
+#include <algorithm>
+#include <iterator>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -48,7 +52,7 @@ ProjectGeometricPhantomImageFilter<TInputImage, TOutputImage>::VerifyPreconditio
 
 template <class TInputImage, class TOutputImage>
 void
-ProjectGeometricPhantomImageFilter<TInputImage, TOutputImage>::GenerateData()
+ProjectGeometricPhantomImageFilter<TInputImage, TOutputImage>::BeforeThreadedGenerateData()
 {
   // Reading figure config file
   if (!m_ConfigFile.empty())
@@ -64,8 +68,8 @@ ProjectGeometricPhantomImageFilter<TInputImage, TOutputImage>::GenerateData()
   if (cov.empty())
     itkExceptionMacro(<< "Empty phantom");
 
-  // Create one add filter per convex object
-  std::vector<typename itk::ImageSource<TOutputImage>::Pointer> projectors;
+  // Transform a copy of each convex object and build their hierarchy
+  GeometricPhantom::ConvexShapeVector shapes;
   for (const auto & convexShape : cov)
   {
     ConvexShape::Pointer co = convexShape->Clone();
@@ -74,30 +78,67 @@ ProjectGeometricPhantomImageFilter<TInputImage, TOutputImage>::GenerateData()
     co->Rescale(m_PhantomScale);
     for (size_t i = 0; i < m_PlaneDirections.size(); i++)
       co->AddClipPlane(m_PlaneDirections[i], m_PlanePositions[i]);
+    shapes.push_back(co);
+  }
+  m_Hierarchy.SetConvexShapes(shapes);
+}
+
+template <class TInputImage, class TOutputImage>
+void
+ProjectGeometricPhantomImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  // Iterators on input and output
+  using InputRegionIterator = ProjectionsRegionConstIteratorRayBased<TInputImage>;
+  InputRegionIterator * itIn = nullptr;
+  itIn = InputRegionIterator::New(this->GetInput(), outputRegionForThread, m_Geometry);
+  itk::ImageRegionIterator<TOutputImage> itOut(this->GetOutput(), outputRegionForThread);
 
-    if (!projectors.empty())
+  // Go over packets of consecutive rays and add the intersection length of
+  // the shapes which may be intersected by at least one ray of the packet
+  constexpr unsigned int                              packetSize = 16;
+  ConvexShape::PointType                              sources[packetSize];
+  ConvexShape::VectorType                             directions[packetSize];
+  ConvexShape::ScalarType                             infDist[packetSize];
+  ConvexShape::ScalarType                             supDist[packetSize];
+  bool                                                intersected[packetSize];
+  typename TOutputImage::PixelType                    values[packetSize];
+  const GeometricPhantom::ConvexShapeVector &         shapes = m_Hierarchy.GetConvexShapes();
+  ConvexShapeBoundingVolumeHierarchy::IndexVectorType candidates, rayCandidates, merged;
+  const itk::SizeValueType                            npix = outputRegionForThread.GetNumberOfPixels();
+  for (itk::SizeValueType first = 0; first < npix; first += packetSize)
+  {
+    const auto n = static_cast<unsigned int>(std::min<itk::SizeValueType>(packetSize, npix - first));
+    candidates.clear();
+    for (unsigned int k = 0; k < n; k++, itIn->Next())
     {
-      using RCOIType = RayConvexIntersectionImageFilter<TOutputImage, TOutputImage>;
-      auto rcoi = RCOIType::New();
-      rcoi->SetInput(projectors.back()->GetOutput());
-      rcoi->SetGeometry(this->GetGeometry());
-      rcoi->SetConvexShape(co);
-      projectors.push_back(rcoi.GetPointer());
+      sources[k] = itIn->GetSourcePosition();
+      directions[k] = itIn->GetDirection();
+      values[k] = static_cast<typename TOutputImage::PixelType>(itIn->Get());
+      m_Hierarchy.FindShapesAlongLine(sources[k], directions[k], rayCandidates);
+      merged.clear();
+      std::set_union(candidates.begin(),
+                     candidates.end(),
+                     rayCandidates.begin(),
+                     rayCandidates.end(),
+                     std::back_inserter(merged));
+      candidates.swap(merged);
     }
-    else
+
+    for (const unsigned int s : candidates)
     {
-      using RCOIType = RayConvexIntersectionImageFilter<TInputImage, TOutputImage>;
-      auto rcoi = RCOIType::New();
-      rcoi->SetInput(this->GetInput());
-      rcoi->SetGeometry(this->GetGeometry());
-      rcoi->SetConvexShape(co);
-      projectors.push_back(rcoi.GetPointer());
+      shapes[s]->AreIntersectedByRays(sources, directions, n, infDist, supDist, intersected);
+      const ConvexShape::ScalarType density = shapes[s]->GetDensity();
+      for (unsigned int k = 0; k < n; k++)
+        if (intersected[k])
+          values[k] += density * (supDist[k] - infDist[k]);
     }
+
+    for (unsigned int k = 0; k < n; k++, ++itOut)
+      itOut.Set(values[k]);
   }
 
-  projectors.back()->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
-  projectors.back()->Update();
-  this->GraftOutput(projectors.back()->GetOutput());
+  delete itIn;
 }
 
 template <class TInputImage, class TOutputImage>
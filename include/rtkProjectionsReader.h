@@ -250,6 +250,12 @@ public:
   itkGetMacro(VectorComponent, unsigned int);
   itkSetMacro(VectorComponent, unsigned int);
 
+  /** Set/Get the number of files following the projection being read which
+   * the operating system is asked to prefetch, see rtk::ReadAheadFiles.
+   * Default is 8, 0 disables the prefetching. */
+  itkSetMacro(NumberOfReadAheadFiles, unsigned int);
+  itkGetConstMacro(NumberOfReadAheadFiles, unsigned int);
+
   /** Set/Get the ImageIO helper class. Often this is created via the object
    * factory mechanism that determines whether a particular ImageIO can
    * read a certain file. This method provides a way to get the ImageIO
@@ -289,6 +295,11 @@ private:
   void
   PropagateI0(itk::ImageBase<OutputImageDimension> ** nextInputBase);
 
+  /** Prefetch the files following the projection being streamed, called
+   * when the streaming filter progresses. */
+  void
+  ReadAhead();
+
   /** The projections reader which template depends on the scanner.
    * It is not typed because we want to keep the data as on disk.
    * The pointer is stored to reference the filter and avoid its destruction. */
@@ -340,6 +351,12 @@ private:
   WaterPrecorrectionVectorType m_WaterPrecorrectionCoefficients;
   bool                         m_ComputeLineIntegral{ true };
   unsigned int                 m_VectorComponent{ 0 };
+  unsigned int                 m_NumberOfReadAheadFiles{ 8 };
+
+  /** Files of the requested projections and end of those already prefetched */
+  size_t m_ReadAheadFirst{ 0 };
+  size_t m_ReadAheadLast{ 0 };
+  size_t m_ReadAheadEnd{ 0 };
 };
 
 } // namespace rtk
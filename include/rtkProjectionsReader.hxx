@@ -29,9 +29,13 @@
 #include <itkChangeInformationImageFilter.h>
 #include <itkCastImageFilter.h>
 #include <itkVectorIndexSelectionCastImageFilter.h>
+#include <itkCommand.h>
+
+#include <algorithm>
 
 // RTK
 #include "rtkIOFactories.h"
+#include "rtkReadAheadFiles.h"
 #include "rtkBoellaardScatterCorrectionImageFilter.h"
 #include "rtkLUTbasedVariableI0RawToAttenuationImageFilter.h"
 #include "rtkConditionalMedianImageFilter.h"
@@ -111,6 +115,11 @@ ProjectionsReader<TOutputImage>::ProjectionsReader()
   m_WaterPrecorrectionFilter = WaterPrecorrectionType::New();
   m_StreamingFilter = StreamingType::New();
 
+  // Prefetch the next files each time a projection has been streamed
+  auto readAheadCommand = itk::SimpleMemberCommand<Self>::New();
+  readAheadCommand->SetCallbackFunction(this, &Self::ReadAhead);
+  m_StreamingFilter->AddObserver(itk::ProgressEvent(), readAheadCommand);
+
   // Default values of parameters
   m_Spacing.Fill(itk::NumericTraits<typename OutputImageType::SpacingValueType>::max());
   m_Origin.Fill(itk::NumericTraits<typename OutputImageType::PointValueType>::max());
@@ -434,12 +443,49 @@ void
 ProjectionsReader<TOutputImage>::GenerateData()
 {
   TOutputImage * output = this->GetOutput();
+
+  // Each file is assumed to contain one projection, i.e., files are indexed
+  // along the last dimension. Otherwise, all files are prefetched at once.
+  constexpr unsigned int projDim = TOutputImage::ImageDimension - 1;
+  if (m_FileNames.size() == output->GetLargestPossibleRegion().GetSize(projDim))
+  {
+    m_ReadAheadFirst =
+      output->GetRequestedRegion().GetIndex(projDim) - output->GetLargestPossibleRegion().GetIndex(projDim);
+    m_ReadAheadLast = m_ReadAheadFirst + output->GetRequestedRegion().GetSize(projDim);
+    m_ReadAheadEnd = std::min(m_ReadAheadFirst + m_NumberOfReadAheadFiles, m_ReadAheadLast);
+  }
+  else
+  {
+    m_ReadAheadFirst = 0;
+    m_ReadAheadLast = m_FileNames.size();
+    m_ReadAheadEnd = m_ReadAheadLast;
+  }
+  if (m_NumberOfReadAheadFiles > 0)
+    ReadAheadFiles(m_FileNames, m_ReadAheadFirst, m_ReadAheadEnd);
+
   m_StreamingFilter->SetNumberOfStreamDivisions(output->GetRequestedRegion().GetSize(TOutputImage::ImageDimension - 1));
   m_StreamingFilter->GetOutput()->SetRequestedRegion(output->GetRequestedRegion());
   m_StreamingFilter->Update();
   this->GraftOutput(m_StreamingFilter->GetOutput());
 }
 
+//--------------------------------------------------------------------
+template <class TOutputImage>
+void
+ProjectionsReader<TOutputImage>::ReadAhead()
+{
+  if (m_NumberOfReadAheadFiles == 0 || m_ReadAheadEnd >= m_ReadAheadLast)
+    return;
+  const auto current =
+    m_ReadAheadFirst + static_cast<size_t>(m_StreamingFilter->GetProgress() * (m_ReadAheadLast - m_ReadAheadFirst));
+  const size_t end = std::min(current + 1 + m_NumberOfReadAheadFiles, m_ReadAheadLast);
+  if (end > m_ReadAheadEnd)
+  {
+    ReadAheadFiles(m_FileNames, m_ReadAheadEnd, end);
+    m_ReadAheadEnd = end;
+  }
+}
+
 //--------------------------------------------------------------------
 template <class TOutputImage>
 template <class TInputImage>
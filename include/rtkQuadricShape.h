@@ -79,6 +79,26 @@ public:
                      ScalarType &       infDist,
                      ScalarType &       supDist) const override;
 
+  /** See rtk::ConvexShape::AreInside. */
+  void
+  AreInside(const PointType * points, unsigned int n, bool * inside) const override;
+
+  /** See rtk::ConvexShape::AreIntersectedByRays. The common cases, i.e., rays
+   * missing the quadric or crossing it along a segment, are computed for all
+   * rays at once and the other ones are delegated to IsIntersectedByRay. */
+  void
+  AreIntersectedByRays(const PointType *  rayOrigins,
+                       const VectorType * rayDirections,
+                       unsigned int       n,
+                       ScalarType *       infDist,
+                       ScalarType *       supDist,
+                       bool *             intersected) const override;
+
+  /** Axis-aligned box containing the quadric. Only ellipsoids, i.e. quadrics
+   * with a positive definite quadratic form, are bounded. */
+  bool
+  GetBoundingBox(PointType & inf, PointType & sup) const override;
+
   /** Rescale object along each direction by a 3D vector. */
   void
   Rescale(const VectorType & r) override;
@@ -0,0 +1,39 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkReadAheadFiles_h
+#define rtkReadAheadFiles_h
+
+#include "RTKExport.h"
+
+#include <string>
+#include <vector>
+
+namespace rtk
+{
+
+/** Ask the operating system to prefetch the content of the files
+ * [first, last) of fileNames in its cache. The call returns immediately, the
+ * files are read asynchronously. It does nothing on systems without
+ * posix_fadvise and for files which cannot be opened. */
+void RTK_EXPORT
+ReadAheadFiles(const std::vector<std::string> & fileNames, size_t first, size_t last);
+
+} // namespace rtk
+
+#endif
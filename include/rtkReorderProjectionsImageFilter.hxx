@@ -22,9 +22,7 @@
 
 #include "rtkGeneralPurposeFunctions.h"
 
-#include <itkImageRegionIteratorWithIndex.h>
-#include <itkImageRegionConstIterator.h>
-#include <itkImageRegionIterator.h>
+#include <itkImageAlgorithm.h>
 
 #include <algorithm> // std::shuffle
 #include <random>    // std::default_random_engine
@@ -114,29 +112,29 @@ ReorderProjectionsImageFilter<TInputImage, TOutputImage>::GenerateOutputInformat
   m_OutputGeometry->Clear();
   m_OutputSignal.clear();
 
-  // Perform the copies
-  for (unsigned int proj = 0; proj < NumberOfProjections; proj++)
-  {
-    // Copy the geometry
-    m_OutputGeometry->SetRadiusCylindricalDetector(m_InputGeometry->GetRadiusCylindricalDetector());
-    m_OutputGeometry->AddProjectionInRadians(m_InputGeometry->GetSourceToIsocenterDistances()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetSourceToDetectorDistances()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetGantryAngles()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetProjectionOffsetsX()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetProjectionOffsetsY()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetOutOfPlaneAngles()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetInPlaneAngles()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetSourceOffsetsX()[m_NewIndices[proj]],
-                                             m_InputGeometry->GetSourceOffsetsY()[m_NewIndices[proj]]);
-    m_OutputGeometry->SetCollimationOfLastProjection(m_InputGeometry->GetCollimationUInf()[m_NewIndices[proj]],
-                                                     m_InputGeometry->GetCollimationUSup()[m_NewIndices[proj]],
-                                                     m_InputGeometry->GetCollimationVInf()[m_NewIndices[proj]],
-                                                     m_InputGeometry->GetCollimationVSup()[m_NewIndices[proj]]);
-
-    // Copy the signal, if any
-    if (m_Permutation == SORT)
-      m_OutputSignal.push_back(m_InputSignal[m_NewIndices[proj]]);
-  }
+  // Copy the geometry and the signal, if any
+  auto gather = [this](const std::vector<double> & v) {
+    std::vector<double> out(m_NewIndices.size());
+    for (unsigned int i = 0; i < m_NewIndices.size(); i++)
+      out[i] = v[m_NewIndices[i]];
+    return out;
+  };
+  m_OutputGeometry->SetRadiusCylindricalDetector(m_InputGeometry->GetRadiusCylindricalDetector());
+  m_OutputGeometry->AddProjectionsInRadians(gather(m_InputGeometry->GetSourceToIsocenterDistances()),
+                                            gather(m_InputGeometry->GetSourceToDetectorDistances()),
+                                            gather(m_InputGeometry->GetGantryAngles()),
+                                            gather(m_InputGeometry->GetProjectionOffsetsX()),
+                                            gather(m_InputGeometry->GetProjectionOffsetsY()),
+                                            gather(m_InputGeometry->GetOutOfPlaneAngles()),
+                                            gather(m_InputGeometry->GetInPlaneAngles()),
+                                            gather(m_InputGeometry->GetSourceOffsetsX()),
+                                            gather(m_InputGeometry->GetSourceOffsetsY()));
+  m_OutputGeometry->SetCollimations(gather(m_InputGeometry->GetCollimationUInf()),
+                                    gather(m_InputGeometry->GetCollimationUSup()),
+                                    gather(m_InputGeometry->GetCollimationVInf()),
+                                    gather(m_InputGeometry->GetCollimationVSup()));
+  if (m_Permutation == SORT)
+    m_OutputSignal = gather(m_InputSignal);
 }
 
 template <class TInputImage, class TOutputImage>
@@ -147,32 +145,22 @@ ReorderProjectionsImageFilter<TInputImage, TOutputImage>::GenerateData()
   this->GetOutput()->SetBufferedRegion(this->GetOutput()->GetRequestedRegion());
   this->GetOutput()->Allocate();
 
-  // Declare regions used in the loop
-  typename TInputImage::RegionType inputRegion = this->GetOutput()->GetRequestedRegion();
-  typename TInputImage::RegionType outputRegion = this->GetOutput()->GetRequestedRegion();
-  inputRegion.SetSize(2, 1);
-  outputRegion.SetSize(2, 1);
-
-  // Copy the projection data
-  for (unsigned int i = 0; i < this->GetOutput()->GetRequestedRegion().GetSize()[2]; i++)
-  {
-    const unsigned int proj = i + this->GetOutput()->GetRequestedRegion().GetIndex()[2];
-
-    // Regions
-    inputRegion.SetIndex(2, m_NewIndices[proj]);
-    outputRegion.SetIndex(2, proj);
-
-    itk::ImageRegionConstIterator<TInputImage> inputProjsIt(this->GetInput(), inputRegion);
-    itk::ImageRegionIterator<TOutputImage>     outputProjsIt(this->GetOutput(), outputRegion);
-
-    // Actual copy
-    while (!outputProjsIt.IsAtEnd())
-    {
-      outputProjsIt.Set(inputProjsIt.Get());
-      ++outputProjsIt;
-      ++inputProjsIt;
-    }
-  }
+  // Copy the projection data, one projection per task
+  const typename TOutputImage::RegionType outputRegion = this->GetOutput()->GetRequestedRegion();
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    outputRegion.GetSize(2),
+    [&](itk::SizeValueType i) {
+      const unsigned int               proj = i + outputRegion.GetIndex(2);
+      typename TInputImage::RegionType inputRegion = outputRegion;
+      inputRegion.SetIndex(2, m_NewIndices[proj]);
+      inputRegion.SetSize(2, 1);
+      typename TOutputImage::RegionType outRegion = outputRegion;
+      outRegion.SetIndex(2, proj);
+      outRegion.SetSize(2, 1);
+      itk::ImageAlgorithm::Copy(this->GetInput(), this->GetOutput(), inputRegion, outRegion);
+    },
+    nullptr);
 }
 
 } // end namespace rtk
@@ -22,6 +22,9 @@
 #include "rtkConfiguration.h"
 #include "rtkFFTProjectionsConvolutionImageFilter.h"
 
+#include <map>
+#include <mutex>
+
 namespace rtk
 {
 
@@ -31,6 +34,13 @@ namespace rtk
  * The filter code is based on FFTConvolutionImageFilter by Gaetan Lehmann
  * (see https://hdl.handle.net/10380/3154)
  *
+ * The spectrum of the deconvolution kernel is computed once per set of
+ * coefficients, pixel spacing and padded projection size, and shared by all
+ * instances of the filter. The cache holds at most
+ * MaximumNumberOfCachedKernels spectra, it is emptied when it is full, and it
+ * can be emptied with ClearKernelCache to release the memory of the spectra
+ * which are not used by any filter anymore.
+ *
  * \test rtkscatterglaretest.cxx
  *
  * \author Sebastien Brousmiche
@@ -82,6 +92,15 @@ public:
     }
   }
 
+  /** Maximum number of kernel spectra kept in the cache shared by all
+   * instances */
+  static constexpr unsigned int MaximumNumberOfCachedKernels = 16;
+
+  /** Empty the cache of kernel spectra shared by all instances. The spectra
+   * currently used by filters are kept by these filters. */
+  static void
+  ClearKernelCache();
+
 protected:
   ScatterGlareCorrectionImageFilter();
   ~ScatterGlareCorrectionImageFilter() override = default;
@@ -92,6 +111,16 @@ protected:
   UpdateFFTProjectionsConvolutionKernel(SizeType size) override;
 
 private:
+  /** Kernel spectra shared by all instances, indexed by the coefficients,
+   * pixel spacing and padded projection size */
+  struct KernelCacheType
+  {
+    std::mutex                                             Mutex;
+    std::map<CoefficientVectorType, FFTOutputImagePointer> Kernels;
+  };
+  static KernelCacheType &
+  GetKernelCache();
+
   CoefficientVectorType m_Coefficients;
   CoefficientVectorType m_PreviousCoefficients;
 }; // end of class
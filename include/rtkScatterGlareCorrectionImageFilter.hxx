@@ -26,7 +26,6 @@
 #include <itkHalfHermitianToRealInverseFFTImageFilter.h>
 #include <itkImageRegionIterator.h>
 #include <itkImageRegionIteratorWithIndex.h>
-#include <itkDivideImageFilter.h>
 
 namespace rtk
 {
@@ -57,6 +56,20 @@ ScatterGlareCorrectionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::Upd
     return; // Up-to-date
   m_PreviousCoefficients = coeffs;
 
+  // The kernel spectra are shared by all instances of the filter, e.g., those
+  // created for each subset of a long acquisition. They are never modified
+  // once computed.
+  KernelCacheType &                 cache = GetKernelCache();
+  const std::lock_guard<std::mutex> lock(cache.Mutex);
+
+  auto cached = cache.Kernels.find(coeffs);
+  if (cached != cache.Kernels.end())
+  {
+    this->m_KernelFFT = cached->second;
+    this->m_KernelFFT->Modified(); // Signals the change of kernel to the CUDA subclass
+    return;
+  }
+
   FFTInputImagePointer kernel = FFTInputImageType::New();
   kernel->SetRegions(size);
   kernel->Allocate();
@@ -93,15 +106,38 @@ ScatterGlareCorrectionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::Upd
   fftK->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
   fftK->Update();
 
-  // Inverse
-  auto div = itk::DivideImageFilter<FFTOutputImageType, FFTOutputImageType, FFTOutputImageType>::New();
-  div->SetConstant1(1.);
-  div->SetInput(1, fftK->GetOutput());
-  div->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  div->Update();
-
-  this->m_KernelFFT = div->GetOutput();
+  // Inverse, in place and as itk::DivideImageFilter for null values
+  this->m_KernelFFT = fftK->GetOutput();
   this->m_KernelFFT->DisconnectPipeline();
+  using FFTOutputPixelType = typename FFTOutputImageType::PixelType;
+  itk::ImageRegionIterator<FFTOutputImageType> itF(this->m_KernelFFT, this->m_KernelFFT->GetLargestPossibleRegion());
+  for (; !itF.IsAtEnd(); ++itF)
+  {
+    if (itF.Get() != FFTOutputPixelType(0.))
+      itF.Set(FFTOutputPixelType(1.) / itF.Get());
+    else
+      itF.Set(itk::NumericTraits<FFTOutputPixelType>::max(FFTOutputPixelType(1.)));
+  }
+  if (cache.Kernels.size() >= MaximumNumberOfCachedKernels)
+    cache.Kernels.clear();
+  cache.Kernels[coeffs] = this->m_KernelFFT;
+}
+
+template <class TInputImage, class TOutputImage, class TFFTPrecision>
+void
+ScatterGlareCorrectionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::ClearKernelCache()
+{
+  KernelCacheType &                 cache = GetKernelCache();
+  const std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Kernels.clear();
+}
+
+template <class TInputImage, class TOutputImage, class TFFTPrecision>
+typename ScatterGlareCorrectionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::KernelCacheType &
+ScatterGlareCorrectionImageFilter<TInputImage, TOutputImage, TFFTPrecision>::GetKernelCache()
+{
+  static KernelCacheType cache;
+  return cache;
 }
 
 } // end namespace rtk
@@ -37,9 +37,17 @@ namespace rtk
  *
  * The filter walks the pixels of a single channel. For each of these pixels,
  * it constructs a matrix by concatenating the gradient vectors of the L channels.
- * The matrix is decomposed using SVD, its singular values are thresholded, and
- * then reconstructed. The resulting matrix is then cut back into L gradient vectors,
- * which are written in output.
+ * The singular values above the threshold are set to the threshold and the
+ * matrix is reconstructed. The resulting matrix is then cut back into L gradient
+ * vectors, which are written in output.
+ *
+ * The SVD is not computed explicitly: the right singular vectors and the squared
+ * singular values are the eigenvectors and eigenvalues of the NxN Gram matrix,
+ * which are computed in closed form with
+ * itk::SymmetricEigenAnalysisFixedDimension, and the thresholded matrix is the
+ * product of the input matrix with an NxN matrix. The Gram matrix is not even
+ * decomposed when its trace shows that all singular values are below the
+ * threshold.
  *
  * \author Cyril Mory
  *
@@ -20,11 +20,8 @@
 #define rtkSingularValueThresholdImageFilter_hxx
 
 
-#include <itkImageRegionIterator.h>
-#include <itkImageRegionConstIterator.h>
-#include <itkImageRegionIteratorWithIndex.h>
-
-#include <itkProgressReporter.h>
+#include <itkImageRegionConstIteratorWithIndex.h>
+#include <itkSymmetricEigenAnalysis.h>
 
 namespace rtk
 {
@@ -54,72 +51,84 @@ SingularValueThresholdImageFilter<TInputImage, TRealType, TOutputImage>::Threade
   itk::ThreadIdType /*threadId*/)
 {
   // Walks the first frame of the outputRegionForThread
-  // For each voxel, creates an input iterator that walks
-  // the last dimension and computes the average, and
-  // a similar output iterator that replaces the output
-  // by their average along last dimension if ROI=1
+  // For each voxel, thresholds the singular values of the
+  // matrix made of the gradient vectors along last dimension
+  constexpr unsigned int Dimension = TInputImage::ImageDimension - 1;
+  using MatrixType = itk::Matrix<double, Dimension, Dimension>;
+  using EigenValuesType = itk::FixedArray<double, Dimension>;
+  using EigenAnalysisType =
+    itk::SymmetricEigenAnalysisFixedDimension<Dimension, MatrixType, EigenValuesType, MatrixType>;
+  EigenAnalysisType eigenAnalysis;
 
   // Create a region containing only the first frame of outputRegionForThread
   typename TInputImage::RegionType FirstFrameRegion = outputRegionForThread;
-  FirstFrameRegion.SetSize(TInputImage::ImageDimension - 1, 1);
-
-  // Iterate on these regions
-  itk::ImageRegionIteratorWithIndex<TInputImage> FakeIterator(this->GetOutput(), FirstFrameRegion);
+  FirstFrameRegion.SetSize(Dimension, 1);
+  itk::ImageRegionConstIteratorWithIndex<TInputImage> FakeIterator(this->GetInput(), FirstFrameRegion);
 
-  // Create a single-voxel region traversing last dimension
-  typename TInputImage::RegionType SingleVoxelRegion = outputRegionForThread;
-  for (unsigned int dim = 0; dim < TInputImage::ImageDimension - 1; dim++)
-    SingleVoxelRegion.SetSize(dim, 1);
+  // The gradient vectors of a voxel are one frame apart in memory
+  const unsigned int         nChannels = outputRegionForThread.GetSize(Dimension);
+  const itk::OffsetValueType inputStride = this->GetInput()->GetOffsetTable()[Dimension];
+  const itk::OffsetValueType outputStride = this->GetOutput()->GetOffsetTable()[Dimension];
+  const double               threshold = m_Threshold;
 
-  // Create a variable to store the jacobian matrix
-  vnl_matrix<double> jacobian(outputRegionForThread.GetSize()[TInputImage::ImageDimension - 1],
-                              TInputImage::ImageDimension - 1);
-
-  while (!FakeIterator.IsAtEnd())
+  for (; !FakeIterator.IsAtEnd(); ++FakeIterator)
   {
-    // Configure the SingleVoxelRegion correctly to follow the FakeIterator
-    // It is the only purpose of this FakeIterator
-    SingleVoxelRegion.SetIndex(FakeIterator.GetIndex());
-
-    // Walk the input along last dimension for this voxel, filling in the jacobian along the way
-    itk::ImageRegionConstIterator<TInputImage> inputIterator(this->GetInput(), SingleVoxelRegion);
-    unsigned int                               row = 0;
-    for (inputIterator.GoToBegin(); !inputIterator.IsAtEnd(); ++inputIterator, row++)
+    const InputPixelType * in =
+      this->GetInput()->GetBufferPointer() + this->GetInput()->ComputeOffset(FakeIterator.GetIndex());
+    OutputPixelType * out =
+      this->GetOutput()->GetBufferPointer() + this->GetOutput()->ComputeOffset(FakeIterator.GetIndex());
+
+    // Gram matrix of the jacobian, whose eigenvalues are the squared singular values
+    MatrixType gram;
+    gram.Fill(0.);
+    for (unsigned int row = 0; row < nChannels; row++)
+      for (unsigned int i = 0; i < Dimension; i++)
+        for (unsigned int j = i; j < Dimension; j++)
+          gram[i][j] += static_cast<double>(in[row * inputStride][i]) * in[row * inputStride][j];
+    double trace = 0.;
+    for (unsigned int i = 0; i < Dimension; i++)
     {
-      typename TInputImage::PixelType gradient = inputIterator.Get();
-      for (unsigned int column = 0; column < TInputImage::ImageDimension - 1; column++)
-      {
-        jacobian[row][column] = gradient[column];
-      }
+      trace += gram[i][i];
+      for (unsigned int j = 0; j < i; j++)
+        gram[i][j] = gram[j][i];
     }
 
-    // Perform the singular value decomposition of the jacobian matrix
-    vnl_svd<double> svd(jacobian);
-
-    // Threshold the singular values. Since they are sorted in descending order, we
-    // can stop as soon as we reach one that is below threshold
-    for (unsigned int i = 0; (i < TInputImage::ImageDimension && svd.W(i) > m_Threshold); i++)
+    // The thresholded jacobian is the jacobian multiplied by V diag(f) V^T,
+    // with V the right singular vectors and f = min(1, threshold / singular value).
+    // It is computed as I + sum_k (f_k - 1) v_k v_k^T, which is the identity
+    // if all singular values are below threshold.
+    MatrixType weights;
+    weights.SetIdentity();
+    if (trace > threshold * threshold)
     {
-      svd.W(i) = m_Threshold;
+      EigenValuesType eigenValues;
+      MatrixType      eigenVectors;
+      eigenAnalysis.ComputeEigenValuesAndVectors(gram, eigenValues, eigenVectors);
+      for (unsigned int k = 0; k < Dimension; k++)
+      {
+        if (eigenValues[k] <= threshold * threshold)
+          continue;
+        const double g = threshold / std::sqrt(eigenValues[k]) - 1.;
+        for (unsigned int i = 0; i < Dimension; i++)
+          for (unsigned int j = 0; j < Dimension; j++)
+            weights[i][j] += g * eigenVectors[k][i] * eigenVectors[k][j];
+      }
     }
 
-    // Reconstruct the jacobian
-    jacobian = svd.recompose();
-
-    // Walk the output along last dimension for this voxel,
-    // replacing gradient vectors with their newly computed value
-    itk::ImageRegionIterator<TInputImage> outputIterator(this->GetOutput(), SingleVoxelRegion);
-    row = 0;
-    for (outputIterator.GoToBegin(); !outputIterator.IsAtEnd(); ++outputIterator, row++)
+    // Replace the gradient vectors with their newly computed value
+    for (unsigned int row = 0; row < nChannels; row++)
     {
-      typename TInputImage::PixelType vector;
-      for (unsigned int column = 0; column < jacobian.cols(); column++)
-        vector[column] = jacobian[row][column];
-
-      outputIterator.Set(vector);
+      const InputPixelType gradient = in[row * inputStride];
+      OutputPixelType      vector;
+      for (unsigned int j = 0; j < Dimension; j++)
+      {
+        double sum = 0.;
+        for (unsigned int i = 0; i < Dimension; i++)
+          sum += gradient[i] * weights[i][j];
+        vector[j] = static_cast<typename OutputPixelType::ValueType>(sum);
+      }
+      out[row * outputStride] = vector;
     }
-
-    ++FakeIterator;
   }
 }
 
@@ -0,0 +1,164 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkStreamingAmsterdamShroud_h
+#define rtkStreamingAmsterdamShroud_h
+
+#include "rtkThreeDCircularProjectionGeometry.h"
+
+#include <itkImage.h>
+#include <itkObject.h>
+#include <itkRecursiveGaussianImageFilter.h>
+
+#include <vector>
+
+namespace rtk
+{
+
+/** \class StreamingAmsterdamShroud
+ * \brief Builds the Amsterdam shroud and its breathing signal one projection
+ * at a time.
+ *
+ * This class computes the same shroud as rtk::AmsterdamShroudImageFilter and
+ * the same signal as rtk::DPExtractShroudSignalImageFilter but it is fed with
+ * the projections as they are acquired, e.g., for on-line 4D CBCT. Each call
+ * to AddProjection processes one projection only: derivative along v,
+ * optional crop, sum along u and unsharp mask along v, which gives the next
+ * column of the shroud. The dynamic program of the signal extraction is
+ * updated with this column only, so the cost per projection does not depend
+ * on the number of projections already processed. The signal can be
+ * retrieved at any time with GetSignal.
+ *
+ * \test rtkamsterdamshroudtest.cxx
+ *
+ * \ingroup RTK
+ */
+template <class TInputImage>
+class ITK_TEMPLATE_EXPORT StreamingAmsterdamShroud : public itk::Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(StreamingAmsterdamShroud);
+
+  /** Standard class type alias. */
+  using Self = StreamingAmsterdamShroud;
+  using Superclass = itk::Object;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  /** Convenient type alias. */
+  using ShroudImageType = itk::Image<double, TInputImage::ImageDimension - 1>;
+  using SignalImageType = itk::Image<double, TInputImage::ImageDimension - 2>;
+  using PointType = itk::Point<double, 3>;
+  using GeometryType = rtk::ThreeDCircularProjectionGeometry;
+  using GeometryPointer = typename GeometryType::Pointer;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkOverrideGetNameOfClassMacro(StreamingAmsterdamShroud);
+
+  /** Size of the unsharp mask, see rtk::AmsterdamShroudImageFilter. */
+  itkGetMacro(UnsharpMaskSize, unsigned int);
+  itkSetMacro(UnsharpMaskSize, unsigned int);
+
+  /** Exploration amplitude of the signal extraction (in mm), see
+   * rtk::DPExtractShroudSignalImageFilter. */
+  itkGetMacro(Amplitude, double);
+  itkSetMacro(Amplitude, double);
+
+  /** Optional geometry and 3D clipbox corners to crop the projections, see
+   * rtk::AmsterdamShroudImageFilter. The projections are assumed to be added
+   * in the order of the geometry. */
+  itkGetModifiableObjectMacro(Geometry, GeometryType);
+  itkSetObjectMacro(Geometry, GeometryType);
+  itkGetMacro(Corner1, PointType);
+  itkSetMacro(Corner1, PointType);
+  itkGetMacro(Corner2, PointType);
+  itkSetMacro(Corner2, PointType);
+
+  /** Forget all projections added so far. */
+  void
+  Reset();
+
+  /** Process one projection, i.e., a TInputImage with one pixel along the last
+   * dimension, and append the corresponding column to the shroud. */
+  void
+  AddProjection(const TInputImage * projection);
+
+  /** Number of projections processed so far. */
+  unsigned int
+  GetNumberOfProjections() const
+  {
+    return static_cast<unsigned int>(m_Shroud.size());
+  }
+
+  /** Shroud of the projections processed so far, as computed by
+   * rtk::AmsterdamShroudImageFilter. */
+  typename ShroudImageType::Pointer
+  GetShroud() const;
+
+  /** Breathing signal of the projections processed so far, as computed by
+   * rtk::DPExtractShroudSignalImageFilter from GetShroud(). The backtracking
+   * of the optimal path is linear in the number of projections. */
+  typename SignalImageType::Pointer
+  GetSignal() const;
+
+  /** Cranio-caudal position (in mm) of the end of the optimal path, which
+   * tracks the breathing motion at the last projection without backtracking. */
+  double
+  GetCurrentPosition() const;
+
+protected:
+  StreamingAmsterdamShroud();
+  ~StreamingAmsterdamShroud() override = default;
+
+  /** Returns the index of the end of the optimal path. */
+  unsigned int
+  GetOptimalPathEnd() const;
+
+private:
+  using DerivativeType = itk::RecursiveGaussianImageFilter<TInputImage, TInputImage>;
+
+  typename DerivativeType::Pointer m_DerivativeFilter;
+  unsigned int                     m_UnsharpMaskSize{ 17 };
+  double                           m_Amplitude{ 0. };
+  GeometryPointer                  m_Geometry{ nullptr };
+  PointType                        m_Corner1{ 0. };
+  PointType                        m_Corner2{ 0. };
+
+  /** Columns of the shroud, one per projection */
+  std::vector<std::vector<double>> m_Shroud;
+
+  /** Dynamic programming: score of the best path ending at each position of
+   * the last column and offset to the previous position for each column. */
+  std::vector<double>           m_Score;
+  std::vector<std::vector<int>> m_From;
+
+  /** Information of the first projection */
+  typename TInputImage::PointType   m_Origin;
+  typename TInputImage::SpacingType m_Spacing;
+}; // end of class
+
+} // end namespace rtk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "rtkStreamingAmsterdamShroud.hxx"
+#endif
+
+#endif
@@ -0,0 +1,246 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkStreamingAmsterdamShroud_hxx
+#define rtkStreamingAmsterdamShroud_hxx
+
+#include <itkImageRegionConstIterator.h>
+
+#include <algorithm>
+
+namespace rtk
+{
+
+template <class TInputImage>
+StreamingAmsterdamShroud<TInputImage>::StreamingAmsterdamShroud()
+{
+  // Same derivative as in AmsterdamShroudImageFilter
+  m_DerivativeFilter = DerivativeType::New();
+  m_DerivativeFilter->SetOrder(itk::GaussianOrderEnum::FirstOrder);
+  m_DerivativeFilter->SetDirection(1);
+  m_DerivativeFilter->SetSigma(4);
+}
+
+template <class TInputImage>
+void
+StreamingAmsterdamShroud<TInputImage>::Reset()
+{
+  m_Shroud.clear();
+  m_Score.clear();
+  m_From.clear();
+  this->Modified();
+}
+
+template <class TInputImage>
+void
+StreamingAmsterdamShroud<TInputImage>::AddProjection(const TInputImage * projection)
+{
+  const typename TInputImage::RegionType region = projection->GetLargestPossibleRegion();
+  if (region.GetSize(2) != 1)
+    itkExceptionMacro(<< "Projections must be added one at a time.");
+  const unsigned int sizeU = region.GetSize(0);
+  const unsigned int sizeV = region.GetSize(1);
+  const unsigned int iProj = GetNumberOfProjections();
+  if (iProj == 0)
+  {
+    projection->TransformIndexToPhysicalPoint(region.GetIndex(), m_Origin);
+    m_Spacing = projection->GetSpacing();
+  }
+  else if (sizeV != m_Shroud[0].size())
+    itkExceptionMacro(<< "All projections must have the same size.");
+
+  // Derivative along v of this projection only
+  m_DerivativeFilter->SetInput(projection);
+  m_DerivativeFilter->UpdateLargestPossibleRegion();
+  typename TInputImage::Pointer derivative = m_DerivativeFilter->GetOutput();
+  derivative->DisconnectPipeline();
+
+  // Projected clipbox, as in AmsterdamShroudImageFilter::CropOutsideProjectedBox
+  double cornerInf[2] = { itk::NumericTraits<double>::NonpositiveMin(), itk::NumericTraits<double>::NonpositiveMin() };
+  double cornerSup[2] = { itk::NumericTraits<double>::max(), itk::NumericTraits<double>::max() };
+  if (m_Geometry.GetPointer())
+  {
+    if (iProj >= m_Geometry->GetMatrices().size())
+      itkExceptionMacro(<< "No geometry for projection #" << iProj);
+    for (unsigned int ci = 0; ci < 8; ci++)
+    {
+      GeometryType::HomogeneousVectorType corner;
+      corner[0] = (ci % 2 == 0) ? m_Corner1[0] : m_Corner2[0];
+      corner[1] = ((ci / 2) % 2 == 0) ? m_Corner1[1] : m_Corner2[1];
+      corner[2] = (ci / 4 == 0) ? m_Corner1[2] : m_Corner2[2];
+      corner[3] = 1.;
+      typename TInputImage::PointType pCorner(0.);
+      vnl_vector<double> pCornerVnl = m_Geometry->GetMatrices()[iProj].GetVnlMatrix() * corner.GetVnlVector();
+      for (unsigned int i = 0; i < 2; i++)
+        pCorner[i] = pCornerVnl[i] / pCornerVnl[2];
+      const itk::ContinuousIndex<double, 3> pCornerI =
+        projection
+          ->template TransformPhysicalPointToContinuousIndex<typename TInputImage::PointType::ValueType, double>(
+            pCorner);
+      for (unsigned int i = 0; i < 2; i++)
+      {
+        cornerInf[i] = (ci == 0) ? pCornerI[i] : std::min(cornerInf[i], pCornerI[i]);
+        cornerSup[i] = (ci == 0) ? pCornerI[i] : std::max(cornerSup[i], pCornerI[i]);
+      }
+    }
+  }
+
+  // Negative part of the derivative summed along u
+  std::vector<double>                        sum(sizeV, 0.);
+  itk::ImageRegionConstIterator<TInputImage> it(derivative, region);
+  typename TInputImage::PixelType            value;
+  for (unsigned int j = 0; j < sizeV; j++)
+  {
+    for (unsigned int i = 0; i < sizeU; i++, ++it)
+    {
+      if (i < cornerInf[0] || i > cornerSup[0] || j < cornerInf[1] || j > cornerSup[1])
+        continue;
+      value = -1. * it.Get();
+      if (value <= 0.)
+        sum[j] += value;
+    }
+  }
+
+  // Unsharp mask along v with zero-flux Neumann boundary conditions, as
+  // itk::ConvolutionImageFilter with the kernel of AmsterdamShroudImageFilter
+  const int           first = -static_cast<int>(m_UnsharpMaskSize - 1 - m_UnsharpMaskSize / 2);
+  const int           last = static_cast<int>(m_UnsharpMaskSize / 2);
+  std::vector<double> column(sizeV);
+  for (int j = 0; j < static_cast<int>(sizeV); j++)
+  {
+    double average = 0.;
+    for (int k = first; k <= last; k++)
+      average += sum[std::min(std::max(j + k, 0), static_cast<int>(sizeV) - 1)] / m_UnsharpMaskSize;
+    column[j] = sum[j] - average;
+  }
+
+  // Update the dynamic program of DPExtractShroudSignalImageFilter with the new
+  // column: each position keeps the best predecessor in the amplitude range.
+  if (iProj == 0)
+    m_Score = column;
+  else
+  {
+    const int           amplitudeInVoxel = m_Amplitude / m_Spacing[1];
+    std::vector<double> score(sizeV, 0.);
+    std::vector<int>    from(sizeV, 0);
+    for (int j = 0; j < static_cast<int>(sizeV); j++)
+    {
+      const int pmin = std::max(j - amplitudeInVoxel, 0);
+      const int pmax = std::min(j + amplitudeInVoxel, static_cast<int>(sizeV) - 1);
+      for (int p = pmin; p <= pmax; p++)
+      {
+        if (column[j] + m_Score[p] > score[j])
+        {
+          score[j] = column[j] + m_Score[p];
+          from[j] = p - j;
+        }
+      }
+    }
+    m_Score.swap(score);
+    m_From.push_back(std::move(from));
+  }
+  m_Shroud.push_back(std::move(column));
+  this->Modified();
+}
+
+template <class TInputImage>
+typename StreamingAmsterdamShroud<TInputImage>::ShroudImageType::Pointer
+StreamingAmsterdamShroud<TInputImage>::GetShroud() const
+{
+  auto shroud = ShroudImageType::New();
+  if (m_Shroud.empty())
+    return shroud;
+
+  typename ShroudImageType::RegionType region;
+  region.SetIndex(0, 0);
+  region.SetIndex(1, 0);
+  region.SetSize(0, m_Shroud[0].size());
+  region.SetSize(1, m_Shroud.size());
+  typename ShroudImageType::PointType   origin;
+  typename ShroudImageType::SpacingType spacing;
+  for (unsigned int i = 0; i < 2; i++)
+  {
+    origin[i] = m_Origin[i + 1];
+    spacing[i] = m_Spacing[i + 1];
+  }
+  shroud->SetRegions(region);
+  shroud->SetOrigin(origin);
+  shroud->SetSpacing(spacing);
+  shroud->Allocate();
+
+  double * buffer = shroud->GetBufferPointer();
+  for (const auto & column : m_Shroud)
+    buffer = std::copy(column.begin(), column.end(), buffer);
+  return shroud;
+}
+
+template <class TInputImage>
+unsigned int
+StreamingAmsterdamShroud<TInputImage>::GetOptimalPathEnd() const
+{
+  unsigned int max = 0;
+  for (unsigned int j = 1; j < m_Score.size(); ++j)
+    if (m_Score[j] > m_Score[max])
+      max = j;
+  return max;
+}
+
+template <class TInputImage>
+typename StreamingAmsterdamShroud<TInputImage>::SignalImageType::Pointer
+StreamingAmsterdamShroud<TInputImage>::GetSignal() const
+{
+  auto signal = SignalImageType::New();
+  if (m_Shroud.empty())
+    return signal;
+
+  typename SignalImageType::RegionType region;
+  region.SetIndex(0, 0);
+  region.SetSize(0, m_Shroud.size());
+  typename SignalImageType::PointType   origin;
+  typename SignalImageType::SpacingType spacing;
+  origin[0] = m_Origin[2];
+  spacing[0] = m_Spacing[2];
+  signal->SetRegions(region);
+  signal->SetOrigin(origin);
+  signal->SetSpacing(spacing);
+  signal->Allocate();
+
+  // Backtracking of the optimal path, the signal is 0 at the last projection
+  double * buffer = signal->GetBufferPointer();
+  int      j = GetOptimalPathEnd();
+  double   value = 0.;
+  buffer[m_Shroud.size() - 1] = value;
+  for (int i = static_cast<int>(m_From.size()) - 1; i >= 0; i--)
+  {
+    value -= m_From[i][j] * m_Spacing[1];
+    buffer[i] = value;
+    j += m_From[i][j];
+  }
+  return signal;
+}
+
+template <class TInputImage>
+double
+StreamingAmsterdamShroud<TInputImage>::GetCurrentPosition() const
+{
+  return m_Origin[1] + GetOptimalPathEnd() * m_Spacing[1];
+}
+
+} // end namespace rtk
+
+#endif
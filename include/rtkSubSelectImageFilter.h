@@ -34,25 +34,13 @@ namespace rtk
  * its corresponding geometry using the two members m_NbSelectedProjs and
  * m_SelectedProjections. The members must be set before
  * GenerateOutputInformation is called. Streaming of the output is possible.
- * The output is produced from the following mini-pipeline:
- *
- * \dot
- * digraph SubSelectImageFilter {
- * Input [label="Input (Projections)", shape=Mdiamond];
- * Output [label="Output (Projections)", shape=Mdiamond];
- *
- * node [shape=box];
- *
- * Constant [label="rtk::ConstantImageSource" URL="\ref rtk::ConstantImageSource"];
- * Extract [label="itk::ExtractImageFilter" URL="\ref itk::ExtractImageFilter"];
- * Paste [label="itk::PasteImageFilter" URL="\ref itk::PasteImageFilter"];
- *
- * Input->Extract
- * Extract->Paste
- * Paste->Output
- * Constant->Paste
- * }
- * \enddot
+ * If the selected projections of the output requested region are dense, i.e.,
+ * if at least half of the projections between the first and the last selected
+ * ones are selected, the input requested region spans them and they are
+ * gathered in parallel, one projection per task, with
+ * itk::ImageAlgorithm::Copy. Otherwise, requesting the span would read and
+ * store many unused projections, so the selected projections are requested
+ * and copied one at a time, updating the input pipeline for each of them.
  *
  * \test rtkadmmtotalvariationtest.cxx, rtkselectoneprojpercycletest.cxx
  *
@@ -81,9 +69,12 @@ public:
   typename ProjectionStackType::ConstPointer
   GetInputProjectionStack();
 
+#ifndef ITK_FUTURE_LEGACY_REMOVE
+  /** Types of the former mini-pipeline, which are not used anymore */
   using PasteFilterType = itk::PasteImageFilter<ProjectionStackType>;
   using ExtractFilterType = itk::ExtractImageFilter<ProjectionStackType, ProjectionStackType>;
   using EmptyProjectionStackSourceType = rtk::ConstantImageSource<ProjectionStackType>;
+#endif
   using GeometryType = rtk::ThreeDCircularProjectionGeometry;
 
   itkSetObjectMacro(InputGeometry, GeometryType);
@@ -112,16 +103,21 @@ protected:
   void
   GenerateData() override;
 
+  /** Indices in the input of the selected projections of the output
+   * requested region */
+  std::vector<itk::IndexValueType>
+  GetRequestedInputIndices();
+
+  /** True if at least half of the projections between the first and the last
+   * indices are selected */
+  static bool
+  IsDenseSelection(const std::vector<itk::IndexValueType> & indices);
+
   /** Member variables */
   GeometryType::Pointer m_InputGeometry;
   GeometryType::Pointer m_OutputGeometry;
   std::vector<bool>     m_SelectedProjections;
   int                   m_NbSelectedProjs;
-
-private:
-  typename EmptyProjectionStackSourceType::Pointer m_EmptyProjectionStackSource;
-  typename ExtractFilterType::Pointer              m_ExtractFilter;
-  typename PasteFilterType::Pointer                m_PasteFilter;
 };
 } // namespace rtk
 
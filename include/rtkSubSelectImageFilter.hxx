@@ -18,6 +18,7 @@
 #ifndef rtkSubSelectImageFilter_hxx
 #define rtkSubSelectImageFilter_hxx
 
+#include <itkImageAlgorithm.h>
 
 namespace rtk
 {
@@ -25,9 +26,6 @@ namespace rtk
 template <typename ProjectionStackType>
 SubSelectImageFilter<ProjectionStackType>::SubSelectImageFilter()
   : m_OutputGeometry(GeometryType::New())
-  , m_EmptyProjectionStackSource(EmptyProjectionStackSourceType::New())
-  , m_ExtractFilter(ExtractFilterType::New())
-  , m_PasteFilter(PasteFilterType::New())
 {}
 
 template <typename ProjectionStackType>
@@ -54,80 +52,105 @@ SubSelectImageFilter<ProjectionStackType>::VerifyPreconditions() const
     itkExceptionMacro(<< "Geometries have not been set.");
 }
 
+template <typename ProjectionStackType>
+std::vector<itk::IndexValueType>
+SubSelectImageFilter<ProjectionStackType>::GetRequestedInputIndices()
+{
+  const unsigned int  Dimension = this->InputImageDimension;
+  itk::IndexValueType first = this->GetOutput()->GetRequestedRegion().GetIndex(Dimension - 1);
+  itk::IndexValueType last = first + this->GetOutput()->GetRequestedRegion().GetSize(Dimension - 1);
+  first -= this->GetOutput()->GetLargestPossibleRegion().GetIndex(Dimension - 1);
+  last -= this->GetOutput()->GetLargestPossibleRegion().GetIndex(Dimension - 1);
+
+  // The n-th selected projection of the input is the n-th projection of the output
+  std::vector<itk::IndexValueType> indices;
+  itk::IndexValueType              counter = 0;
+  for (unsigned int i = 0; i < m_SelectedProjections.size() && counter < last; i++)
+  {
+    if (m_SelectedProjections[i])
+    {
+      if (counter >= first)
+        indices.push_back(this->GetInput()->GetLargestPossibleRegion().GetIndex(Dimension - 1) + i);
+      counter++;
+    }
+  }
+  return indices;
+}
+
 template <typename ProjectionStackType>
 void
 SubSelectImageFilter<ProjectionStackType>::GenerateInputRequestedRegion()
 {
   const unsigned int Dimension = this->InputImageDimension;
 
-  // Find first selected projection (if it exists)
-  unsigned int firstSel = 0;
-  for (firstSel = 0; firstSel < m_SelectedProjections.size() && !(m_SelectedProjections[firstSel]); firstSel++)
-    ;
-  if (firstSel == m_SelectedProjections.size())
+  const std::vector<itk::IndexValueType> indices = this->GetRequestedInputIndices();
+  if (indices.empty())
   {
     itkGenericExceptionMacro(<< "No projection selected.");
   }
 
-  // Only request the first projection at first
-  typename ExtractFilterType::InputImageRegionType projRegion;
-  projRegion = this->GetOutput()->GetRequestedRegion();
-  projRegion.SetSize(Dimension - 1, 1);
-  projRegion.SetIndex(Dimension - 1, firstSel);
-  m_ExtractFilter->SetExtractionRegion(projRegion);
-  m_ExtractFilter->UpdateOutputInformation();
-  m_ExtractFilter->GetOutput()->SetRequestedRegion(projRegion);
-  m_ExtractFilter->GetOutput()->PropagateRequestedRegion();
+  // Request the projections between the first and the last selected ones if
+  // the selection is dense, only the first one otherwise. The others are then
+  // requested one by one in GenerateData.
+  typename ProjectionStackType::RegionType projRegion = this->GetOutput()->GetRequestedRegion();
+  projRegion.SetIndex(Dimension - 1, indices.front());
+  if (IsDenseSelection(indices))
+    projRegion.SetSize(Dimension - 1, indices.back() - indices.front() + 1);
+  else
+    projRegion.SetSize(Dimension - 1, 1);
+  auto * input = const_cast<ProjectionStackType *>(this->GetInput());
+  input->SetRequestedRegion(projRegion);
+}
+
+template <typename ProjectionStackType>
+bool
+SubSelectImageFilter<ProjectionStackType>::IsDenseSelection(const std::vector<itk::IndexValueType> & indices)
+{
+  // At most one projection out of two is not selected between the first and
+  // the last selected ones
+  return indices.back() - indices.front() + 1 <= 2 * static_cast<itk::IndexValueType>(indices.size());
 }
 
 template <typename ProjectionStackType>
 void
 SubSelectImageFilter<ProjectionStackType>::GenerateOutputInformation()
 {
-  unsigned int                             Dimension = this->GetInput(0)->GetImageDimension();
-  typename ProjectionStackType::RegionType outputLargestPossibleRegion = this->GetInput(0)->GetLargestPossibleRegion();
-  outputLargestPossibleRegion.SetSize(Dimension - 1, m_NbSelectedProjs);
-
-  // Create a stack of empty projection images
-  typename ProjectionStackType::SizeType ProjectionStackSize;
-  ProjectionStackSize = this->GetInputProjectionStack()->GetLargestPossibleRegion().GetSize();
-  ProjectionStackSize[Dimension - 1] = m_NbSelectedProjs;
-  m_EmptyProjectionStackSource->SetInformationFromImage(this->GetInputProjectionStack());
-  m_EmptyProjectionStackSource->SetSize(ProjectionStackSize);
-  m_EmptyProjectionStackSource->UpdateOutputInformation();
-  this->GetOutput()->CopyInformation(m_EmptyProjectionStackSource->GetOutput());
+  const unsigned int Dimension = this->InputImageDimension;
+  Superclass::GenerateOutputInformation();
 
-  // Mini-pipeline connections
-  m_ExtractFilter->SetInput(this->GetInput());
-  m_PasteFilter->SetSourceImage(m_ExtractFilter->GetOutput());
-  m_PasteFilter->SetDestinationImage(m_EmptyProjectionStackSource->GetOutput());
+  typename ProjectionStackType::RegionType outputLargestPossibleRegion = this->GetInput()->GetLargestPossibleRegion();
+  outputLargestPossibleRegion.SetSize(Dimension - 1, m_NbSelectedProjs);
+  this->GetOutput()->SetLargestPossibleRegion(outputLargestPossibleRegion);
 
   // Update output geometry
   // NOTE : The output geometry must be computed here, not in the GenerateData(),
   // because downstream forward and backprojection filters will need this geometry
   // to compute their output information and input requested region
+  std::vector<unsigned int> selected;
+  for (unsigned int i = 0; i < m_SelectedProjections.size(); i++)
+    if (m_SelectedProjections[i])
+      selected.push_back(i);
+  auto gather = [&selected](const std::vector<double> & v) {
+    std::vector<double> out(selected.size());
+    for (unsigned int i = 0; i < selected.size(); i++)
+      out[i] = v[selected[i]];
+    return out;
+  };
   m_OutputGeometry->Clear();
   m_OutputGeometry->SetRadiusCylindricalDetector(m_InputGeometry->GetRadiusCylindricalDetector());
-
-  for (unsigned long i = 0; i < m_SelectedProjections.size(); i++)
-  {
-    if (m_SelectedProjections[i])
-    {
-      m_OutputGeometry->AddProjectionInRadians(m_InputGeometry->GetSourceToIsocenterDistances()[i],
-                                               m_InputGeometry->GetSourceToDetectorDistances()[i],
-                                               m_InputGeometry->GetGantryAngles()[i],
-                                               m_InputGeometry->GetProjectionOffsetsX()[i],
-                                               m_InputGeometry->GetProjectionOffsetsY()[i],
-                                               m_InputGeometry->GetOutOfPlaneAngles()[i],
-                                               m_InputGeometry->GetInPlaneAngles()[i],
-                                               m_InputGeometry->GetSourceOffsetsX()[i],
-                                               m_InputGeometry->GetSourceOffsetsY()[i]);
-      m_OutputGeometry->SetCollimationOfLastProjection(m_InputGeometry->GetCollimationUInf()[i],
-                                                       m_InputGeometry->GetCollimationUSup()[i],
-                                                       m_InputGeometry->GetCollimationVInf()[i],
-                                                       m_InputGeometry->GetCollimationVSup()[i]);
-    }
-  }
+  m_OutputGeometry->AddProjectionsInRadians(gather(m_InputGeometry->GetSourceToIsocenterDistances()),
+                                            gather(m_InputGeometry->GetSourceToDetectorDistances()),
+                                            gather(m_InputGeometry->GetGantryAngles()),
+                                            gather(m_InputGeometry->GetProjectionOffsetsX()),
+                                            gather(m_InputGeometry->GetProjectionOffsetsY()),
+                                            gather(m_InputGeometry->GetOutOfPlaneAngles()),
+                                            gather(m_InputGeometry->GetInPlaneAngles()),
+                                            gather(m_InputGeometry->GetSourceOffsetsX()),
+                                            gather(m_InputGeometry->GetSourceOffsetsY()));
+  m_OutputGeometry->SetCollimations(gather(m_InputGeometry->GetCollimationUInf()),
+                                    gather(m_InputGeometry->GetCollimationUSup()),
+                                    gather(m_InputGeometry->GetCollimationVInf()),
+                                    gather(m_InputGeometry->GetCollimationVSup()));
 }
 
 template <typename ProjectionStackType>
@@ -141,48 +164,48 @@ template <typename ProjectionStackType>
 void
 SubSelectImageFilter<ProjectionStackType>::GenerateData()
 {
-  unsigned int Dimension = this->GetInput(0)->GetImageDimension();
+  const unsigned int Dimension = this->InputImageDimension;
 
-  // Set the extract filter
-  typename ExtractFilterType::InputImageRegionType projRegion;
-  projRegion = this->GetOutput()->GetRequestedRegion();
-  projRegion.SetSize(Dimension - 1, 1);
-  m_ExtractFilter->SetExtractionRegion(projRegion);
+  this->AllocateOutputs();
 
-  // Count the projections actually used in constructing the output
-  int counter = 0;
+  const std::vector<itk::IndexValueType>         indices = this->GetRequestedInputIndices();
+  const typename ProjectionStackType::RegionType outputRegion = this->GetOutput()->GetRequestedRegion();
 
-  for (unsigned int i = 0; i < m_SelectedProjections.size(); i++)
+  // Sparse selection: update and copy the selected projections one by one
+  if (!IsDenseSelection(indices))
   {
-    if (m_SelectedProjections[i])
+    auto * input = const_cast<ProjectionStackType *>(this->GetInput());
+    for (unsigned int i = 0; i < indices.size(); i++)
     {
-      // After the first update, we need to use the output as input.
-      if (counter > 0)
+      typename ProjectionStackType::RegionType inRegion = outputRegion;
+      inRegion.SetIndex(Dimension - 1, indices[i]);
+      inRegion.SetSize(Dimension - 1, 1);
+      if (i > 0)
       {
-        typename ProjectionStackType::Pointer pimg = m_PasteFilter->GetOutput();
-        pimg->DisconnectPipeline();
-        m_PasteFilter->SetDestinationImage(pimg);
+        input->SetRequestedRegion(inRegion);
+        input->PropagateRequestedRegion();
+        input->UpdateOutputData();
       }
-
-      // Set the Extract Filter
-      projRegion.SetIndex(Dimension - 1, i);
-      m_ExtractFilter->SetExtractionRegion(projRegion);
-
-      // Set the Paste filter
-      m_PasteFilter->SetSourceRegion(projRegion);
-      typename ProjectionStackType::IndexType DestinationIndex = projRegion.GetIndex();
-      DestinationIndex[Dimension - 1] = counter;
-      m_PasteFilter->SetDestinationIndex(DestinationIndex);
-
-      // Update the filters
-      projRegion.SetIndex(Dimension - 1, counter);
-      m_PasteFilter->UpdateLargestPossibleRegion();
-
-      counter++;
+      typename ProjectionStackType::RegionType outRegion = inRegion;
+      outRegion.SetIndex(Dimension - 1, outputRegion.GetIndex(Dimension - 1) + i);
+      itk::ImageAlgorithm::Copy(this->GetInput(), this->GetOutput(), inRegion, outRegion);
     }
+    return;
   }
 
-  this->GraftOutput(m_PasteFilter->GetOutput());
+  // Dense selection: gather the selected projections, one projection per task
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    indices.size(),
+    [&](itk::SizeValueType i) {
+      typename ProjectionStackType::RegionType inRegion = outputRegion;
+      inRegion.SetIndex(Dimension - 1, indices[i]);
+      inRegion.SetSize(Dimension - 1, 1);
+      typename ProjectionStackType::RegionType outRegion = inRegion;
+      outRegion.SetIndex(Dimension - 1, outputRegion.GetIndex(Dimension - 1) + i);
+      itk::ImageAlgorithm::Copy(this->GetInput(), this->GetOutput(), inRegion, outRegion);
+    },
+    nullptr);
 }
 
 } // namespace rtk
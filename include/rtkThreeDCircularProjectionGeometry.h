@@ -146,6 +146,41 @@ public:
   bool
   AddProjection(const HomogeneousProjectionMatrixType & pMat);
 
+  /** Add several projections with one call, e.g., from arrays in Python. The
+   * parameters are those of AddProjection, angles in degrees. gantryAngles
+   * defines the number of projections and each other vector must have the same
+   * size, one value used for all projections or no value for the default value
+   * of AddProjection. The matrices of the projections are computed in
+   * parallel. */
+  void
+  AddProjections(const std::vector<double> & sids,
+                 const std::vector<double> & sdds,
+                 const std::vector<double> & gantryAngles,
+                 const std::vector<double> & projOffsetsX = std::vector<double>(),
+                 const std::vector<double> & projOffsetsY = std::vector<double>(),
+                 const std::vector<double> & outOfPlaneAngles = std::vector<double>(),
+                 const std::vector<double> & inPlaneAngles = std::vector<double>(),
+                 const std::vector<double> & sourceOffsetsX = std::vector<double>(),
+                 const std::vector<double> & sourceOffsetsY = std::vector<double>());
+
+  /** Idem with angles in radians. */
+  void
+  AddProjectionsInRadians(const std::vector<double> & sids,
+                          const std::vector<double> & sdds,
+                          const std::vector<double> & gantryAngles,
+                          const std::vector<double> & projOffsetsX = std::vector<double>(),
+                          const std::vector<double> & projOffsetsY = std::vector<double>(),
+                          const std::vector<double> & outOfPlaneAngles = std::vector<double>(),
+                          const std::vector<double> & inPlaneAngles = std::vector<double>(),
+                          const std::vector<double> & sourceOffsetsX = std::vector<double>(),
+                          const std::vector<double> & sourceOffsetsY = std::vector<double>());
+
+  /** Add projections from projection matrices stored contiguously, row by row,
+   * i.e., 12 values per projection as in a Nx3x4 C-ordered array. Returns true
+   * if all projections could be added, see AddProjection. */
+  bool
+  AddProjections(const std::vector<double> & matrices);
+
   /** Empty the geometry object. */
   void
   Clear() override;
@@ -320,6 +355,14 @@ public:
   void
   SetCollimationOfLastProjection(double uinf, double usup, double vinf, double vsup);
 
+  /** Set the collimation of all projections with one value per projection in
+   * each vector. */
+  void
+  SetCollimations(const std::vector<double> & uinf,
+                  const std::vector<double> & usup,
+                  const std::vector<double> & vinf,
+                  const std::vector<double> & vsup);
+
   /** Get the source position for the ith projection in the fixed reference
    * system and in homogeneous coordinates. */
   HomogeneousVectorType
@@ -451,6 +494,49 @@ protected:
   itk::LightObject::Pointer
   InternalClone() const override;
 
+  /** Sub-matrices, projection matrix and source angle of one projection. They
+   * do not depend on the other projections so that several projections can be
+   * computed in parallel before being appended to the geometry. */
+  struct ProjectionMatrices
+  {
+    TwoDHomogeneousMatrixType   ProjectionTranslation;
+    Superclass::MatrixType      Magnification;
+    ThreeDHomogeneousMatrixType Rotation;
+    ThreeDHomogeneousMatrixType SourceTranslation;
+    Superclass::MatrixType      Matrix;
+    double                      SourceAngle;
+  };
+
+  /** Computes the matrices of a projection, angles in radians. */
+  static ProjectionMatrices
+  ComputeProjectionMatrices(double sid,
+                            double sdd,
+                            double gantryAngle,
+                            double projOffsetX,
+                            double projOffsetY,
+                            double outOfPlaneAngle,
+                            double inPlaneAngle,
+                            double sourceOffsetX,
+                            double sourceOffsetY);
+
+  /** Appends a projection with its precomputed matrices, angles in radians. */
+  void
+  AppendProjection(double                     sid,
+                   double                     sdd,
+                   double                     gantryAngle,
+                   double                     projOffsetX,
+                   double                     projOffsetY,
+                   double                     outOfPlaneAngle,
+                   double                     inPlaneAngle,
+                   double                     sourceOffsetX,
+                   double                     sourceOffsetY,
+                   const ProjectionMatrices & matrices);
+
+  /** Throws if a projection with this source to detector distance cannot be
+   * added, parallel and divergent projections cannot be mixed. */
+  void
+  CheckParallelOrDivergent(double sdd) const;
+
   /** Circular geometry parameters per projection (angles in degrees between 0
     and 360). */
   std::vector<double> m_GantryAngles;
@@ -0,0 +1,66 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkThreeDCircularProjectionGeometryBinaryFile_h
+#define rtkThreeDCircularProjectionGeometryBinaryFile_h
+
+#include "RTKExport.h"
+#include "rtkThreeDCircularProjectionGeometry.h"
+
+namespace rtk
+{
+
+/** Binary geometry format, a compact alternative to the XML format for
+ * geometries with many projections. A file contains, in little endian:
+ * - the 8 characters "RTKGEOM" and a null character,
+ * - the format version and the number of projections n as 32-bit unsigned
+ *   integers,
+ * - the radius of the cylindrical detector as a double,
+ * - 13 arrays of n doubles: gantry, out-of-plane and in-plane angles in
+ *   radians, source to isocenter distances, source offsets X and Y, source to
+ *   detector distances, projection offsets X and Y and the four collimation
+ *   parameters (UInf, USup, VInf, VSup).
+ * All arrays are aligned on 8 bytes so that the file can be memory mapped.
+ * The convenience functions ReadGeometry and WriteGeometry use this format
+ * for files with the BinaryGeometryFileExtension extension.
+ *
+ * \test rtkgeometryfiletest.cxx
+ *
+ * \author Simon Rit
+ *
+ * \ingroup RTK IOFilters
+ */
+constexpr char BinaryGeometryFileExtension[] = ".rtkg";
+
+/** Writes geometry in filename with the binary geometry format. */
+RTK_EXPORT void
+WriteGeometryBinary(const ThreeDCircularProjectionGeometry * geometry, const std::string & filename);
+
+/** Reads a geometry written with WriteGeometryBinary. The matrices of the
+ * projections are computed in parallel. */
+RTK_EXPORT ThreeDCircularProjectionGeometry::Pointer
+           ReadGeometryBinary(const std::string & filename);
+
+/** Returns true if filename starts with the signature of the binary geometry
+ * format. */
+RTK_EXPORT bool
+IsGeometryBinaryFile(const std::string & filename);
+
+} // namespace rtk
+
+#endif
@@ -120,7 +120,8 @@ private:
 /** Convenience function for reading a geometry XML file.
  *
  * The function reads the geometry from the specified XML file, and returns the
- * geometry that it has read.
+ * geometry that it has read. Files in the binary geometry format are also
+ * accepted, see rtkThreeDCircularProjectionGeometryBinaryFile.h.
  * */
 RTK_EXPORT ThreeDCircularProjectionGeometry::Pointer
            ReadGeometry(const std::string & filename);
@@ -25,7 +25,9 @@
 
 #include "RTKExport.h"
 #include "rtkThreeDCircularProjectionGeometry.h"
+#include "rtkThreeDCircularProjectionGeometryBinaryFile.h"
 #include <itkXMLFile.h>
+#include <itksys/SystemTools.hxx>
 
 namespace rtk
 {
@@ -87,6 +89,7 @@ protected:
 /** Convenience function for writing an geometry.
  *
  * The geometry parameter may be a either SmartPointer or a raw pointer and const or non-const.
+ * The binary geometry format is used if filename has the BinaryGeometryFileExtension.
  * */
 template <typename TGeometryPointer>
 ITK_TEMPLATE_EXPORT void
@@ -97,6 +100,12 @@ WriteGeometry(TGeometryPointer && geometry, const std::string & filename)
                   itk::mpl::IsSmartPointer<NonReferenceImagePointer>::Value,
                 "WriteGeometry requires a raw pointer or SmartPointer.");
 
+  if (itksys::SystemTools::GetFilenameLastExtension(filename) == BinaryGeometryFileExtension)
+  {
+    WriteGeometryBinary(&*geometry, filename);
+    return;
+  }
+
   auto writer = ThreeDCircularProjectionGeometryXMLFileWriter::New();
   writer->SetObject(geometry);
   writer->SetFilename(filename);
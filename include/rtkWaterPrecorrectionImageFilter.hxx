@@ -19,9 +19,7 @@
 #ifndef rtkWaterPrecorrectionImageFilter_hxx
 #define rtkWaterPrecorrectionImageFilter_hxx
 
-#include <itkImageRegionConstIterator.h>
-#include <itkImageRegionIterator.h>
-
+#include <itkImageScanlineIterator.h>
 
 namespace rtk
 {
@@ -39,51 +37,29 @@ WaterPrecorrectionImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerat
 {
   const int csize = m_Coefficients.size();
 
-  typename itk::ImageRegionConstIterator<TInputImage> itIn(this->GetInput(), outputRegionForThread);
-  typename itk::ImageRegionIterator<TOutputImage>     itOut(this->GetOutput(), outputRegionForThread);
-
-  if (csize >= 3)
-  {
-    itIn.GoToBegin();
-    itOut.GoToBegin();
-
-    while (!itIn.IsAtEnd())
-    {
-      float v = itIn.Get();
-      float out = m_Coefficients[0] + m_Coefficients[1] * v;
-      float bpow = v * v;
+  // Nothing to do with the default coefficients
+  if (csize == 0 || (csize == 1 && m_Coefficients[0] == 0) ||
+      (csize == 2 && m_Coefficients[0] == 0 && m_Coefficients[1] == 1))
+    return;
 
-      for (int i = 2; i < csize; i++)
-      {
-        out += m_Coefficients[i] * bpow;
-        bpow = bpow * v;
-      }
-      itOut.Set(out);
+  // Evaluate the polynomial with Horner's scheme, line by line on the buffer
+  // so that the loop over the pixels can be vectorized
+  const double *     c = m_Coefficients.data();
+  const unsigned int lineLength = outputRegionForThread.GetSize(0);
 
-      ++itIn;
-      ++itOut;
-    }
-  }
-  else if ((csize == 2) && ((m_Coefficients[0] != 0) || (m_Coefficients[1] != 1)))
-  {
-    itIn.GoToBegin();
-    itOut.GoToBegin();
-    while (!itIn.IsAtEnd())
-    {
-      itOut.Set(m_Coefficients[0] + m_Coefficients[1] * itIn.Get());
-      ++itIn;
-      ++itOut;
-    }
-  }
-  else if ((csize == 1) && (m_Coefficients[0] != 0))
+  itk::ImageScanlineConstIterator<TInputImage> itIn(this->GetInput(), outputRegionForThread);
+  itk::ImageScanlineIterator<TOutputImage>     itOut(this->GetOutput(), outputRegionForThread);
+  for (; !itIn.IsAtEnd(); itIn.NextLine(), itOut.NextLine())
   {
-    itIn.GoToBegin();
-    itOut.GoToBegin();
-    while (!itIn.IsAtEnd())
+    const typename TInputImage::PixelType * in = &(itIn.Value());
+    typename TOutputImage::PixelType *      out = &(itOut.Value());
+    for (unsigned int i = 0; i < lineLength; i++)
     {
-      itOut.Set(m_Coefficients[0]);
-      ++itIn;
-      ++itOut;
+      const double v = in[i];
+      double       value = c[csize - 1];
+      for (int k = csize - 2; k >= 0; k--)
+        value = value * v + c[k];
+      out[i] = value;
     }
   }
 }
@@ -22,17 +22,12 @@
 #include "rtkConfiguration.h"
 #include "rtkBackProjectionImageFilter.h"
 #include "rtkMacro.h"
+#include "rtkZengDepthDependentBlur.h"
 #include <itkPixelTraits.h>
 
 #include <itkAddImageFilter.h>
 #include <itkCenteredEuler3DTransform.h>
-#include <itkChangeInformationImageFilter.h>
-#include <itkConstantBoundaryCondition.h>
-#include <itkDiscreteGaussianImageFilter.h>
-#include <itkExtractImageFilter.h>
 #include <itkMultiplyImageFilter.h>
-#include <itkPasteImageFilter.h>
-#include <itkRegionOfInterestImageFilter.h>
 #include <itkResampleImageFilter.h>
 #include <itkUnaryGeneratorImageFilter.h>
 #include <itkVector.h>
@@ -54,6 +49,11 @@ namespace rtk
  * after the source and the volume. If the detector is in the volume the sum is
  * performed only until that point.
  *
+ * For each projection, the depth-dependent blur is applied incrementally from
+ * slice to slice (see ZengDepthDependentBlur) directly in a rotated volume
+ * buffer which is reused from one projection to the next, and this buffer is
+ * then rotated back and accumulated in the output.
+ *
  * \dot
  * digraph ZengBackProjectionImageFilter {
  *
@@ -69,35 +69,21 @@ namespace rtk
  *  node [shape=box];
  *
  *  Add [ label="itk::AddImageFilter" URL="\ref itk::AddImageFilter"];
- *  Paste [ label="itk::PasteImageFilter" URL="\ref itk::PasteImageFilter"];
- *  Gaussian [ label="itk::DiscreteGaussianFilter" URL="\ref itk::DiscreteGaussianFilter"];
+ *  Blur [ label="rtk::ZengDepthDependentBlur" URL="\ref rtk::ZengDepthDependentBlur"];
  *  Resample [ label="itk::ResampleImageFilter" URL="\ref itk::ResampleImageFilter"];
  *  Multiply [ label="itk::MultiplyImageFilter" URL="\ref itk::MultiplyImageFilter"];
- *  Constant [ label="itk::ConstantVolumeSource" URL="\ref itk::ConstantVolumeSource"];
- *  Extract [ label="itk::ExtractImageFilter" URL="\ref itk::ExtractImageFilter"];
- *  ChangeInfo [ label="itk::ChangeInformationImageFilter" URL="\ref itk::ChangeInformationImageFilter"];
- *  AttMultiply [ label="itk::MultiplyImageFilter" URL="\ref itk::MultiplyImageFilter"];
- *  ROI [ label="itk::RegionOfInterestImageFilter" URL="\ref itk::RegionOfInterestImageFilter"];
+ *  Constant [ label="rtk::ConstantImageSource" URL="\ref rtk::ConstantImageSource"];
  *  AttResample [ label="itk::ResampleImageFilter" URL="\ref itk::ResampleImageFilter"];
- *  AttChangeInfo [ label="itk::ChangeInformationImageFilter" URL="\ref itk::ChangeInformationImageFilter"];
  *  Unary [ label="itk::UnaryGeneratorImageFilter" URL="\ref itk::UnaryGeneratorImageFilter"];
  *  Multiply -> Add;
  *  Resample -> Multiply;
- *  Extract -> ChangeInfo;
- *  Input1 -> Extract
- *  ChangeInfo -> Gaussian;
+ *  Input1 -> Blur;
  *  Input2 -> Unary;
  *  Unary -> AttResample;
- *  AttResample -> ROI;
- *  ROI -> AttChangeInfo;
- *  ChangeInfo -> AttMultiply;
- *  AttChangeInfo -> AttMultiply;
- *  AttMultiply -> Gaussian;
- *  Gaussian -> Paste;
- *  Constant -> Paste;
- *  Paste -> Resample;
+ *  AttResample -> Blur;
+ *  Constant -> Blur;
+ *  Blur -> Resample;
  *  Input0 -> Add;
- *  Gaussian -> AttMultiply;
  *  Add -> Output;
  *  }
  * \enddot
@@ -128,33 +114,21 @@ public:
   using ConstPointer = itk::SmartPointer<const Self>;
   using AddImageFilterType = itk::AddImageFilter<InputCPUImageType, InputCPUImageType>;
   using AddImageFilterPointerType = typename AddImageFilterType::Pointer;
-  using PasteImageFilterType = itk::PasteImageFilter<InputCPUImageType, OuputCPUImageType>;
-  using PasteImageFilterPointerType = typename PasteImageFilterType::Pointer;
-  using DiscreteGaussianFilterType = itk::DiscreteGaussianImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using DiscreteGaussianFilterPointeurType = typename DiscreteGaussianFilterType::Pointer;
   using ResampleImageFilterType = itk::ResampleImageFilter<InputCPUImageType, InputCPUImageType>;
   using ResampleImageFilterPointerType = typename ResampleImageFilterType::Pointer;
   using TransformType = itk::CenteredEuler3DTransform<double>;
   using TransformPointerType = typename TransformType::Pointer;
-  using ChangeInformationFilterType = itk::ChangeInformationImageFilter<OuputCPUImageType>;
-  using ChangeInformationPointerType = typename ChangeInformationFilterType::Pointer;
   using MultiplyImageFilterType = itk::MultiplyImageFilter<InputCPUImageType, InputCPUImageType>;
   using MultiplyImageFilterPointerType = typename MultiplyImageFilterType::Pointer;
   using ConstantVolumeSourceType = rtk::ConstantImageSource<InputCPUImageType>;
   using ConstantVolumeSourcePointerType = typename ConstantVolumeSourceType::Pointer;
-  using ExtractImageFilterType = itk::ExtractImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using ExtractImageFilterPointerType = typename ExtractImageFilterType::Pointer;
-  using RegionOfInterestFilterType = itk::RegionOfInterestImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using RegionOfInterestPointerType = typename RegionOfInterestFilterType::Pointer;
   using CustomUnaryFilterType = itk::UnaryGeneratorImageFilter<OuputCPUImageType, OuputCPUImageType>;
   using CustomUnaryFilterPointerType = typename CustomUnaryFilterType::Pointer;
+  using BlurType = ZengDepthDependentBlur<InputPixelType>;
 
   /** ImageDimension constants */
   static constexpr unsigned int InputImageDimension = TInputImage::ImageDimension;
 
-  /** Typedef for the boundary condition */
-  using BoundaryCondition = itk::ConstantBoundaryCondition<OuputCPUImageType>;
-
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -189,21 +163,13 @@ protected:
   void
   VerifyInputInformation() const override;
 
-  AddImageFilterPointerType          m_AddImageFilter;
-  PasteImageFilterPointerType        m_PasteImageFilter;
-  DiscreteGaussianFilterPointeurType m_DiscreteGaussianFilter;
-  ResampleImageFilterPointerType     m_ResampleImageFilter;
-  TransformPointerType               m_Transform;
-  MultiplyImageFilterPointerType     m_MultiplyImageFilter;
-  ConstantVolumeSourcePointerType    m_ConstantVolumeSource;
-  ExtractImageFilterPointerType      m_ExtractImageFilter;
-  ChangeInformationPointerType       m_ChangeInformation;
-  MultiplyImageFilterPointerType     m_AttenuationMapMultiplyImageFilter;
-  RegionOfInterestPointerType        m_AttenuationMapRegionOfInterest;
-  ResampleImageFilterPointerType     m_AttenuationMapResampleImageFilter;
-  ChangeInformationPointerType       m_AttenuationMapChangeInformation;
-  BoundaryCondition                  m_BoundsCondition;
-  CustomUnaryFilterPointerType       m_CustomUnaryFilter;
+  AddImageFilterPointerType       m_AddImageFilter;
+  ResampleImageFilterPointerType  m_ResampleImageFilter;
+  TransformPointerType            m_Transform;
+  MultiplyImageFilterPointerType  m_MultiplyImageFilter;
+  ConstantVolumeSourcePointerType m_ConstantVolumeSource;
+  ResampleImageFilterPointerType  m_AttenuationMapResampleImageFilter;
+  CustomUnaryFilterPointerType    m_CustomUnaryFilter;
 
 private:
   ZengBackProjectionImageFilter(const Self &) = delete; // purposely not implemented
@@ -42,31 +42,16 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::ZengBackProjectionImag
 
   // Create each filter of the composite filter
   m_AddImageFilter = AddImageFilterType::New();
-  m_PasteImageFilter = PasteImageFilterType::New();
-  m_DiscreteGaussianFilter = DiscreteGaussianFilterType::New();
   m_ResampleImageFilter = ResampleImageFilterType::New();
   m_Transform = TransformType::New();
   m_MultiplyImageFilter = MultiplyImageFilterType::New();
-  m_ExtractImageFilter = ExtractImageFilterType::New();
   m_ConstantVolumeSource = ConstantVolumeSourceType::New();
-  m_ChangeInformation = ChangeInformationFilterType::New();
-  m_AttenuationMapMultiplyImageFilter = nullptr;
-  m_AttenuationMapRegionOfInterest = nullptr;
   m_AttenuationMapResampleImageFilter = nullptr;
-  m_AttenuationMapChangeInformation = nullptr;
   m_CustomUnaryFilter = nullptr;
 
   // Permanent internal connections
   m_AddImageFilter->SetInput2(m_MultiplyImageFilter->GetOutput());
   m_MultiplyImageFilter->SetInput(m_ResampleImageFilter->GetOutput());
-  m_ChangeInformation->SetInput(m_ExtractImageFilter->GetOutput());
-  m_ChangeInformation->ChangeSpacingOn();
-
-  // Default parameters
-  m_DiscreteGaussianFilter->SetMaximumError(0.00001);
-  m_DiscreteGaussianFilter->SetFilterDimensionality(2);
-  m_DiscreteGaussianFilter->SetInputBoundaryCondition(&m_BoundsCondition);
-  m_DiscreteGaussianFilter->SetRealBoundaryCondition(&m_BoundsCondition);
 }
 
 template <class TInputImage, class TOutputImage>
@@ -74,6 +59,11 @@ void
 ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateInputRequestedRegion()
 {
   Superclass::GenerateInputRequestedRegion();
+  // Input 1 is the stack of projections which are read in full in GenerateData
+  typename Superclass::InputImagePointer inputPtr1 = const_cast<TInputImage *>(this->GetInput(1));
+  if (inputPtr1)
+    inputPtr1->SetRequestedRegionToLargestPossibleRegion();
+
   // Input 2 is the attenuation map relative to the volume
   typename Superclass::InputImagePointer inputPtr2 = const_cast<TInputImage *>(this->GetInput(2));
   if (!inputPtr2)
@@ -215,34 +205,10 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateOutputInformat
   outputSpacing[1] = spacingProjections[1];
   outputSpacing[2] = spacingVolume[2];
 
-  // We only set the first sub-stack at that point, the rest will be
-  // requested in the GenerateData function
-  typename ExtractImageFilterType::InputImageRegionType projRegion;
-  const unsigned int                                    Dimension = this->InputImageDimension;
-  projRegion = this->GetInput(1)->GetLargestPossibleRegion();
-  m_ExtractImageFilter->SetExtractionRegion(projRegion);
-  m_ExtractImageFilter->SetInput(this->GetInput(1));
-  m_ExtractImageFilter->UpdateOutputInformation();
-  m_ChangeInformation->SetOutputSpacing(outputSpacing);
-  m_ChangeInformation->UpdateOutputInformation();
-
-  m_DiscreteGaussianFilter->SetVariance(pow(m_SigmaZero, 2.0));
-
-  if (!(this->GetInput(2)))
-  {
-    m_DiscreteGaussianFilter->SetInput(m_ChangeInformation->GetOutput());
-  }
-  else
+  if (this->GetInput(2))
   {
-    m_AttenuationMapMultiplyImageFilter = MultiplyImageFilterType::New();
-    m_AttenuationMapRegionOfInterest = RegionOfInterestFilterType::New();
     m_AttenuationMapResampleImageFilter = ResampleImageFilterType::New();
-    m_AttenuationMapChangeInformation = ChangeInformationFilterType::New();
     m_CustomUnaryFilter = CustomUnaryFilterType::New();
-    m_AttenuationMapChangeInformation->ChangeOriginOn();
-    m_AttenuationMapChangeInformation->ChangeRegionOn();
-    m_AttenuationMapChangeInformation->SetReferenceImage(m_ChangeInformation->GetOutput());
-    m_AttenuationMapChangeInformation->SetUseReferenceImage(true);
 
     // Set Lambda function
     auto customLambda = [spacingVolume](const typename OuputCPUImageType::PixelType & input1) ->
@@ -261,18 +227,6 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateOutputInformat
     m_AttenuationMapResampleImageFilter->SetInput(m_CustomUnaryFilter->GetOutput());
     m_AttenuationMapResampleImageFilter->SetDefaultPixelValue(1.);
     m_AttenuationMapResampleImageFilter->UpdateOutputInformation();
-
-    typename RegionOfInterestFilterType::InputImageRegionType attRegion;
-    attRegion = m_AttenuationMapResampleImageFilter->GetOutput()->GetLargestPossibleRegion();
-    attRegion.SetSize(Dimension - 1, 1);
-    m_AttenuationMapRegionOfInterest->SetRegionOfInterest(attRegion);
-    m_AttenuationMapRegionOfInterest->SetInput(m_AttenuationMapResampleImageFilter->GetOutput());
-    m_AttenuationMapRegionOfInterest->UpdateOutputInformation();
-
-    m_AttenuationMapChangeInformation->SetInput(m_AttenuationMapRegionOfInterest->GetOutput());
-    m_AttenuationMapMultiplyImageFilter->SetInput1(m_ChangeInformation->GetOutput());
-    m_AttenuationMapMultiplyImageFilter->SetInput2(m_AttenuationMapChangeInformation->GetOutput());
-    m_DiscreteGaussianFilter->SetInput(m_AttenuationMapMultiplyImageFilter->GetOutput());
   }
 
   m_MultiplyImageFilter->SetConstant(spacingVolume[2]);
@@ -284,11 +238,7 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateOutputInformat
   m_ConstantVolumeSource->SetDirection(this->GetInput(1)->GetDirection());
   m_ConstantVolumeSource->SetConstant(0);
 
-  m_PasteImageFilter->SetSourceImage(m_DiscreteGaussianFilter->GetOutput());
-  m_PasteImageFilter->SetDestinationImage(m_ConstantVolumeSource->GetOutput());
-  m_PasteImageFilter->SetSourceRegion(m_DiscreteGaussianFilter->GetOutput()->GetLargestPossibleRegion());
-
-  m_ResampleImageFilter->SetInput(m_PasteImageFilter->GetOutput());
+  m_ResampleImageFilter->SetInput(m_ConstantVolumeSource->GetOutput());
   m_AddImageFilter->SetInput1(this->GetInput(0));
 
   // Update output information
@@ -306,10 +256,9 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateData()
   const typename Superclass::GeometryType::ConstPointer geometry = this->GetGeometry();
   const unsigned int                                    Dimension = this->InputImageDimension;
 
-  typename ExtractImageFilterType::InputImageRegionType projRegion;
-  projRegion = this->GetInput(1)->GetLargestPossibleRegion();
-  int                 indexProj = 0;
-  std::vector<double> list_angle;
+  typename InputCPUImageType::RegionType projRegion = this->GetInput(1)->GetLargestPossibleRegion();
+  int                                    indexProj = 0;
+  std::vector<double>                    list_angle;
   if (geometry->GetGantryAngles().size() != projRegion.GetSize(Dimension - 1))
   {
     indexProj = projRegion.GetIndex(Dimension - 1);
@@ -320,17 +269,31 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateData()
     list_angle = geometry->GetGantryAngles();
   }
 
-  projRegion.SetSize(Dimension - 1, 1);
-
-  typename OuputCPUImageType::Pointer                       currentSlice;
-  typename OuputCPUImageType::Pointer                       pimg;
-  typename OuputCPUImageType::Pointer                       currentVolume;
-  typename OuputCPUImageType::PointType                     pointSlice;
-  typename OuputCPUImageType::IndexType                     indexSlice{};
-  typename OuputCPUImageType::Pointer                       rotatedAttenuation;
-  typename RegionOfInterestFilterType::InputImageRegionType desiredRegion;
-  PointType                                                 centerRotatedVolume;
-  PointType                                                 originRotatedVolume;
+  // The rotated volume is filled slice by slice in a buffer which is reused
+  // for all projections
+  m_ConstantVolumeSource->Update();
+  typename InputCPUImageType::Pointer rotatedVolume = m_ConstantVolumeSource->GetOutput();
+  rotatedVolume->DisconnectPipeline();
+  m_ResampleImageFilter->SetInput(rotatedVolume);
+  InputPixelType *         rotatedVolumeBuffer = rotatedVolume->GetBufferPointer();
+  const int                nbSlice = rotatedVolume->GetLargestPossibleRegion().GetSize()[Dimension - 1];
+  const itk::SizeValueType sliceSize = rotatedVolume->GetLargestPossibleRegion().GetSize()[0] *
+                                       rotatedVolume->GetLargestPossibleRegion().GetSize()[1];
+
+  // Detector-sized blur, reused for all slices and all projections
+  BlurType blur;
+  blur.SetSliceGeometry(rotatedVolume->GetLargestPossibleRegion().GetSize()[0],
+                        rotatedVolume->GetLargestPossibleRegion().GetSize()[1],
+                        rotatedVolume->GetSpacing()[0],
+                        rotatedVolume->GetSpacing()[1]);
+  blur.SetMultiThreader(this->GetMultiThreader());
+
+  typename OuputCPUImageType::Pointer   pimg;
+  typename OuputCPUImageType::PointType pointSlice;
+  typename OuputCPUImageType::IndexType indexSlice{};
+  typename InputCPUImageType::IndexType indexProjection = projRegion.GetIndex();
+  PointType                             centerRotatedVolume;
+  PointType                             originRotatedVolume;
 
   double dist = NAN, sigmaSlice = NAN;
   double thicknessSlice = this->GetInput(0)->GetSpacing()[2];
@@ -346,111 +309,79 @@ ZengBackProjectionImageFilter<TInputImage, TOutputImage>::GenerateData()
     centerRotatedVolume = m_Transform->GetMatrix() * m_centerVolume;
 
     // Set the new origin of the rotate volume according to the center
-    originRotatedVolume = m_ConstantVolumeSource->GetOrigin();
-    originRotatedVolume[2] = centerRotatedVolume[2] - m_ConstantVolumeSource->GetSpacing()[2] *
-                                                        (double)(m_ConstantVolumeSource->GetSize()[2] - 1) / 2.0;
-    m_ConstantVolumeSource->SetOrigin(originRotatedVolume);
+    originRotatedVolume = rotatedVolume->GetOrigin();
+    originRotatedVolume[2] = centerRotatedVolume[2] - rotatedVolume->GetSpacing()[2] * (double)(nbSlice - 1) / 2.0;
+    rotatedVolume->SetOrigin(originRotatedVolume);
+    rotatedVolume->FillBuffer(0);
 
     // Set the rotation angle.
     m_ResampleImageFilter->SetTransform(m_Transform->GetInverseTransform());
 
-    // Extract the projection corresponding to the current angle from the projection stack
-    projRegion.SetIndex(Dimension - 1, nbProjections);
-    m_ExtractImageFilter->SetExtractionRegion(projRegion);
-    m_ExtractImageFilter->UpdateOutputInformation();
-
     // Find the first positive distance between the volume and the detector
-    m_ConstantVolumeSource->Update();
-    int nbSlice = m_ConstantVolumeSource->GetOutput()->GetLargestPossibleRegion().GetSize()[2];
     dist = -1;
     startSlice = -1;
     while (dist < 0)
     {
       startSlice += 1;
       indexSlice[Dimension - 1] = startSlice;
-      m_ConstantVolumeSource->GetOutput()->TransformIndexToPhysicalPoint(indexSlice, pointSlice);
+      rotatedVolume->TransformIndexToPhysicalPoint(indexSlice, pointSlice);
       dist = geometry->GetSourceToIsocenterDistances()[nbProjections] +
              pointSlice.GetVectorFromOrigin() * m_VectorOrthogonalDetector;
     }
+    const InputPixelType * rotatedAttenuationBuffer = nullptr;
     if (this->GetInput(2))
     {
       m_AttenuationMapResampleImageFilter->SetOutputOrigin(originRotatedVolume);
       m_AttenuationMapResampleImageFilter->Update();
-      rotatedAttenuation = m_AttenuationMapResampleImageFilter->GetOutput();
-      rotatedAttenuation->DisconnectPipeline();
-      desiredRegion = rotatedAttenuation->GetLargestPossibleRegion();
-      desiredRegion.SetSize(Dimension - 1, 1);
-      desiredRegion.SetIndex(Dimension - 1, startSlice);
-      m_AttenuationMapRegionOfInterest->SetInput(rotatedAttenuation);
-      m_AttenuationMapRegionOfInterest->SetRegionOfInterest(desiredRegion);
-      m_AttenuationMapRegionOfInterest->UpdateOutputInformation();
+      rotatedAttenuationBuffer = m_AttenuationMapResampleImageFilter->GetOutput()->GetBufferPointer();
+    }
+
+    // Copy the projection corresponding to the current angle in the first slice
+    indexProjection[Dimension - 1] = nbProjections;
+    const InputPixelType * projection =
+      this->GetInput(1)->GetBufferPointer() + this->GetInput(1)->ComputeOffset(indexProjection);
+    InputPixelType * currentSlice = rotatedVolumeBuffer + startSlice * sliceSize;
+    for (itk::SizeValueType p = 0; p < sliceSize; p++)
+      currentSlice[p] = projection[p];
+    if (rotatedAttenuationBuffer)
+    {
+      const InputPixelType * attenuationSlice = rotatedAttenuationBuffer + startSlice * sliceSize;
+      for (itk::SizeValueType p = 0; p < sliceSize; p++)
+        currentSlice[p] *= attenuationSlice[p];
     }
+
     // Compute the variance of the PSF for the first slice
     sigmaSlice = pow(m_Alpha * dist + m_SigmaZero, 2.0);
-    m_DiscreteGaussianFilter->SetVariance(sigmaSlice);
-    m_DiscreteGaussianFilter->UpdateLargestPossibleRegion();
-    currentSlice = m_DiscreteGaussianFilter->GetOutput();
-    currentSlice->DisconnectPipeline();
-
-    // Paste the blur slice into the output volume
-    m_PasteImageFilter->SetDestinationImage(m_ConstantVolumeSource->GetOutput());
-    m_PasteImageFilter->SetSourceImage(currentSlice);
-    m_PasteImageFilter->SetSourceRegion(currentSlice->GetLargestPossibleRegion());
-    m_PasteImageFilter->SetDestinationIndex(indexSlice);
-    m_PasteImageFilter->Update();
-    currentVolume = m_PasteImageFilter->GetOutput();
-    currentVolume->DisconnectPipeline();
-    m_PasteImageFilter->SetDestinationImage(currentVolume);
-    int index = 0;
-    for (index = startSlice; index < nbSlice - 1; index++)
+    blur.Blur(currentSlice, sigmaSlice);
+
+    for (int index = startSlice; index < nbSlice - 1; index++)
     {
-      if (!this->GetInput(2))
-      {
-        m_DiscreteGaussianFilter->SetInput(currentSlice);
-      }
-      else
+      // Propagate the current slice to the next one
+      InputPixelType * nextSlice = rotatedVolumeBuffer + (index + 1) * sliceSize;
+      for (itk::SizeValueType p = 0; p < sliceSize; p++)
+        nextSlice[p] = currentSlice[p];
+      if (rotatedAttenuationBuffer)
       {
-        desiredRegion.SetIndex(Dimension - 1, index + 1);
-        m_AttenuationMapRegionOfInterest->SetRegionOfInterest(desiredRegion);
-        m_AttenuationMapRegionOfInterest->UpdateOutputInformation();
-        m_AttenuationMapMultiplyImageFilter->SetInput1(currentSlice);
-        m_DiscreteGaussianFilter->SetInput(m_AttenuationMapMultiplyImageFilter->GetOutput());
+        const InputPixelType * attenuationSlice = rotatedAttenuationBuffer + (index + 1) * sliceSize;
+        for (itk::SizeValueType p = 0; p < sliceSize; p++)
+          nextSlice[p] *= attenuationSlice[p];
       }
+
       // Compute the distance between the current slice and the detector
-      indexSlice[Dimension - 1] = index + 1;
-      dist += m_ConstantVolumeSource->GetSpacing()[2];
+      dist += rotatedVolume->GetSpacing()[2];
       // Compute the variance of the PSF for the current slice
       sigmaSlice = dist * 2. * thicknessSlice * pow(m_Alpha, 2.0) + 2. * thicknessSlice * m_Alpha * m_SigmaZero -
                    pow(m_Alpha, 2.0) * pow(thicknessSlice, 2.0);
-      m_DiscreteGaussianFilter->SetVariance(sigmaSlice);
-      m_DiscreteGaussianFilter->Update();
-      currentSlice = m_DiscreteGaussianFilter->GetOutput();
-      currentSlice->DisconnectPipeline();
-
-      // Paste the blur slice into the output volume
-      m_PasteImageFilter->SetSourceImage(currentSlice);
-      m_PasteImageFilter->SetSourceRegion(currentSlice->GetLargestPossibleRegion());
-      m_PasteImageFilter->SetDestinationIndex(indexSlice);
-      m_PasteImageFilter->Update();
-      currentVolume = m_PasteImageFilter->GetOutput();
-      currentVolume->DisconnectPipeline();
-      m_PasteImageFilter->SetDestinationImage(currentVolume);
+      blur.Blur(nextSlice, sigmaSlice);
+      currentSlice = nextSlice;
     }
+
     // Rotate the volume
-    m_ResampleImageFilter->SetInput(currentVolume);
+    rotatedVolume->Modified();
     m_AddImageFilter->Update();
     pimg = m_AddImageFilter->GetOutput();
     pimg->DisconnectPipeline();
     m_AddImageFilter->SetInput1(pimg);
-    if (!this->GetInput(2))
-    {
-      m_DiscreteGaussianFilter->SetInput(m_ChangeInformation->GetOutput());
-    }
-    else
-    {
-      m_AttenuationMapMultiplyImageFilter->SetInput1(m_ChangeInformation->GetOutput());
-      m_DiscreteGaussianFilter->SetInput(m_AttenuationMapMultiplyImageFilter->GetOutput());
-    }
     nbProjections++;
   }
   this->GetOutput()->SetPixelContainer(pimg->GetPixelContainer());
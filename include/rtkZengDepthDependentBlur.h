@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef rtkZengDepthDependentBlur_h
+#define rtkZengDepthDependentBlur_h
+
+#include <algorithm>
+#include <vector>
+
+#include <itkGaussianOperator.h>
+#include <itkMultiThreaderBase.h>
+
+namespace rtk
+{
+
+/** \class ZengDepthDependentBlur
+ * \brief Separable Gaussian blur of one detector-sized slice, as used by the
+ * Zeng projectors.
+ *
+ * The Zeng projectors propagate a slice through the rotated volume and blur it
+ * between two successive slices with a Gaussian whose variance is the
+ * increment of the depth-dependent PSF variance. This class applies this blur
+ * directly on a contiguous buffer of SizeX x SizeY pixels with zero boundary
+ * conditions, using the same kernels as itk::DiscreteGaussianImageFilter, and
+ * can optionally fuse the addition of the next slice and the multiplication by
+ * the attenuation factors of this slice. The scratch buffer is kept between
+ * calls so that no allocation occurs in the slice loop.
+ *
+ * \ingroup RTK Projector
+ */
+template <class TPixel>
+class ZengDepthDependentBlur
+{
+public:
+  using SizeValueType = itk::SizeValueType;
+
+  /** Set the size and spacing (in mm) of the slices. */
+  void
+  SetSliceGeometry(SizeValueType sizeX, SizeValueType sizeY, double spacingX, double spacingY)
+  {
+    m_SizeX = sizeX;
+    m_SizeY = sizeY;
+    m_SpacingX = spacingX;
+    m_SpacingY = spacingY;
+    m_Scratch.resize(m_SizeX * m_SizeY);
+  }
+
+  /** Set the multithreader used to process rows in parallel. */
+  void
+  SetMultiThreader(itk::MultiThreaderBase * mt)
+  {
+    m_MultiThreader = mt;
+  }
+
+  /** Blur slice in place with a Gaussian of the given physical variance. If
+   * addend is not null, it is added to the blurred slice and if weights is not
+   * null, the result is then multiplied pixel-wise by weights. */
+  void
+  Blur(TPixel * slice, double variance, const TPixel * addend = nullptr, const TPixel * weights = nullptr)
+  {
+    const std::vector<double> kx = this->ComputeKernel(variance / (m_SpacingX * m_SpacingX));
+    const std::vector<double> ky = this->ComputeKernel(variance / (m_SpacingY * m_SpacingY));
+    const int                 rx = static_cast<int>(kx.size() / 2);
+    const int                 ry = static_cast<int>(ky.size() / 2);
+    const int                 sx = static_cast<int>(m_SizeX);
+    const int                 sy = static_cast<int>(m_SizeY);
+    TPixel *                  scratch = m_Scratch.data();
+
+    // Convolution along the rows, from slice to scratch
+    m_MultiThreader->ParallelizeArray(
+      0,
+      m_SizeY,
+      [&](SizeValueType j) {
+        const TPixel * in = slice + j * m_SizeX;
+        TPixel *       out = scratch + j * m_SizeX;
+        for (int i = 0; i < sx; i++)
+        {
+          const int kmin = std::max(-rx, -i);
+          const int kmax = std::min(rx, sx - 1 - i);
+          double    sum = 0.;
+          for (int k = kmin; k <= kmax; k++)
+            sum += kx[k + rx] * in[i + k];
+          out[i] = static_cast<TPixel>(sum);
+        }
+      },
+      nullptr);
+
+    // Convolution along the columns, from scratch to slice, fused with the
+    // optional addition and multiplication
+    m_MultiThreader->ParallelizeArray(
+      0,
+      m_SizeY,
+      [&](SizeValueType jj) {
+        const int j = static_cast<int>(jj);
+        const int kmin = std::max(-ry, -j);
+        const int kmax = std::min(ry, sy - 1 - j);
+        TPixel *  out = slice + jj * m_SizeX;
+        for (int i = 0; i < sx; i++)
+        {
+          double sum = 0.;
+          for (int k = kmin; k <= kmax; k++)
+            sum += ky[k + ry] * scratch[(j + k) * sx + i];
+          if (addend)
+            sum += addend[jj * m_SizeX + i];
+          if (weights)
+            sum *= weights[jj * m_SizeX + i];
+          out[i] = static_cast<TPixel>(sum);
+        }
+      },
+      nullptr);
+  }
+
+private:
+  /** Coefficients of the 1D Gaussian kernel for a variance in pixels, with the
+   * maximum error and kernel width previously used with
+   * itk::DiscreteGaussianImageFilter in the Zeng projectors. */
+  std::vector<double>
+  ComputeKernel(double varianceInPixels) const
+  {
+    itk::GaussianOperator<double, 1> oper;
+    oper.SetDirection(0);
+    oper.SetVariance(varianceInPixels);
+    oper.SetMaximumError(0.00001);
+    oper.SetMaximumKernelWidth(32);
+    oper.CreateDirectional();
+
+    std::vector<double> kernel(oper.Size());
+    for (unsigned int i = 0; i < oper.Size(); i++)
+      kernel[i] = oper[i];
+    return kernel;
+  }
+
+  SizeValueType            m_SizeX{ 0 };
+  SizeValueType            m_SizeY{ 0 };
+  double                   m_SpacingX{ 1. };
+  double                   m_SpacingY{ 1. };
+  std::vector<TPixel>      m_Scratch;
+  itk::MultiThreaderBase * m_MultiThreader{ nullptr };
+};
+
+} // end namespace rtk
+
+#endif
@@ -22,16 +22,10 @@
 #include "rtkConfiguration.h"
 #include "rtkForwardProjectionImageFilter.h"
 #include "rtkMacro.h"
+#include "rtkZengDepthDependentBlur.h"
 #include <itkPixelTraits.h>
 
-#include <itkAddImageFilter.h>
 #include <itkCenteredEuler3DTransform.h>
-#include <itkChangeInformationImageFilter.h>
-#include <itkConstantBoundaryCondition.h>
-#include <itkDiscreteGaussianImageFilter.h>
-#include <itkMultiplyImageFilter.h>
-#include <itkPasteImageFilter.h>
-#include <itkRegionOfInterestImageFilter.h>
 #include <itkResampleImageFilter.h>
 #include <itkUnaryGeneratorImageFilter.h>
 #include <itkVector.h>
@@ -51,6 +45,12 @@ namespace rtk
  * placed after the source and the volume. If the detector is in the volume the
  * sum is performed only until that point.
  *
+ * For each projection, the volume (and the attenuation map, if any) is rotated
+ * once into a buffer which is reused from one projection to the next. The
+ * depth-dependent blur is then applied incrementally from slice to slice
+ * directly on a detector-sized buffer (see ZengDepthDependentBlur) and the
+ * result is written in the output projection without intermediate pipelines.
+ *
  * \test rtkZengforwardprojectiontest.cxx
  *
  * \author Antoine Robert
@@ -76,31 +76,17 @@ public:
   using Superclass = ForwardProjectionImageFilter<TInputImage, TOutputImage>;
   using Pointer = itk::SmartPointer<Self>;
   using ConstPointer = itk::SmartPointer<const Self>;
-  using AddImageFilterType = itk::AddImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using AddImageFilterPointerType = typename AddImageFilterType::Pointer;
-  using PasteImageFilterType = itk::PasteImageFilter<OuputCPUImageType, InputCPUImageType>;
-  using PasteImageFilterPointerType = typename PasteImageFilterType::Pointer;
-  using DiscreteGaussianFilterType = itk::DiscreteGaussianImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using DiscreteGaussianFilterPointeurType = typename DiscreteGaussianFilterType::Pointer;
   using ResampleImageFilterType = itk::ResampleImageFilter<OuputCPUImageType, OuputCPUImageType>;
   using ResampleImageFilterPointerType = typename ResampleImageFilterType::Pointer;
   using TransformType = itk::CenteredEuler3DTransform<double>;
   using TransformPointerType = typename TransformType::Pointer;
-  using ChangeInformationFilterType = itk::ChangeInformationImageFilter<OuputCPUImageType>;
-  using ChangeInformationPointerType = typename ChangeInformationFilterType::Pointer;
-  using RegionOfInterestFilterType = itk::RegionOfInterestImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using RegionOfInterestPointerType = typename RegionOfInterestFilterType::Pointer;
-  using MultiplyImageFilterType = itk::MultiplyImageFilter<OuputCPUImageType, OuputCPUImageType>;
-  using MultpiplyImageFilterPointerType = typename MultiplyImageFilterType::Pointer;
   using CustomUnaryFilterType = itk::UnaryGeneratorImageFilter<OuputCPUImageType, OuputCPUImageType>;
   using CustomUnaryFilterPointerType = typename CustomUnaryFilterType::Pointer;
+  using BlurType = ZengDepthDependentBlur<OutputPixelType>;
 
   /** ImageDimension constants */
   static constexpr unsigned int InputImageDimension = TOutputImage::ImageDimension;
 
-  /** Typedef for the boundary condition */
-  using BoundaryCondition = itk::ConstantBoundaryCondition<OuputCPUImageType>;
-
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -125,6 +111,10 @@ protected:
   void
   GenerateOutputInformation() override;
 
+  /** The projections are written directly in the output buffer. */
+  void
+  EnlargeOutputRequestedRegion(itk::DataObject * output) override;
+
   void
   GenerateData() override;
 
@@ -133,21 +123,10 @@ protected:
   void
   VerifyInputInformation() const override;
 
-  RegionOfInterestPointerType        m_RegionOfInterest;
-  AddImageFilterPointerType          m_AddImageFilter;
-  PasteImageFilterPointerType        m_PasteImageFilter;
-  DiscreteGaussianFilterPointeurType m_DiscreteGaussianFilter;
-  ResampleImageFilterPointerType     m_ResampleImageFilter;
-  TransformPointerType               m_Transform;
-  ChangeInformationPointerType       m_ChangeInformation;
-  MultpiplyImageFilterPointerType    m_MultiplyImageFilter;
-  MultpiplyImageFilterPointerType    m_AttenuationMapMultiplyImageFilter;
-  RegionOfInterestPointerType        m_AttenuationMapRegionOfInterest;
-  ResampleImageFilterPointerType     m_AttenuationMapResampleImageFilter;
-  ChangeInformationPointerType       m_AttenuationMapChangeInformation;
-  BoundaryCondition                  m_BoundsCondition;
-  CustomUnaryFilterPointerType       m_CustomUnaryFilter;
-
+  ResampleImageFilterPointerType m_ResampleImageFilter;
+  TransformPointerType           m_Transform;
+  ResampleImageFilterPointerType m_AttenuationMapResampleImageFilter;
+  CustomUnaryFilterPointerType   m_CustomUnaryFilter;
 
 private:
   ZengForwardProjectionImageFilter(const Self &) = delete; // purposely not implemented
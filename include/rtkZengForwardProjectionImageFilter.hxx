@@ -28,6 +28,7 @@
 #include "rtkBoxShape.h"
 #include "rtkProjectionsRegionConstIteratorRayBased.h"
 
+#include <itkImageAlgorithm.h>
 #include <itkImageRegionIteratorWithIndex.h>
 #include <itkInputDataObjectConstIterator.h>
 
@@ -41,33 +42,10 @@ ZengForwardProjectionImageFilter<TInputImage, TOutputImage>::ZengForwardProjecti
   m_VectorOrthogonalDetector[2] = 1;
 
   // Create each filter of the composite filter
-  m_RegionOfInterest = RegionOfInterestFilterType::New();
-  m_AddImageFilter = AddImageFilterType::New();
-  m_PasteImageFilter = PasteImageFilterType::New();
-  m_DiscreteGaussianFilter = DiscreteGaussianFilterType::New();
   m_ResampleImageFilter = ResampleImageFilterType::New();
   m_Transform = TransformType::New();
-  m_ChangeInformation = ChangeInformationFilterType::New();
-  m_MultiplyImageFilter = MultiplyImageFilterType::New();
-  m_AttenuationMapMultiplyImageFilter = nullptr;
-  m_AttenuationMapRegionOfInterest = nullptr;
   m_AttenuationMapResampleImageFilter = nullptr;
-  m_AttenuationMapChangeInformation = nullptr;
   m_CustomUnaryFilter = nullptr;
-
-  // Permanent internal connections
-  m_AddImageFilter->SetInput1(m_DiscreteGaussianFilter->GetOutput());
-  m_AddImageFilter->SetInput2(m_ChangeInformation->GetOutput());
-  m_MultiplyImageFilter->SetInput(m_PasteImageFilter->GetOutput());
-
-  // Default parameters
-  m_DiscreteGaussianFilter->SetMaximumError(0.00001);
-  m_DiscreteGaussianFilter->SetFilterDimensionality(2);
-  m_DiscreteGaussianFilter->SetInputBoundaryCondition(&m_BoundsCondition);
-  m_DiscreteGaussianFilter->SetRealBoundaryCondition(&m_BoundsCondition);
-  m_ChangeInformation->ChangeOriginOn();
-  m_ChangeInformation->SetReferenceImage(m_DiscreteGaussianFilter->GetOutput());
-  m_ChangeInformation->SetUseReferenceImage(true);
 }
 
 template <class TInputImage, class TOutputImage>
@@ -224,31 +202,9 @@ ZengForwardProjectionImageFilter<TInputImage, TOutputImage>::GenerateOutputInfor
   m_ResampleImageFilter->SetInput(this->GetInput(1));
   m_ResampleImageFilter->UpdateOutputInformation();
 
-  // We only set the first sub-stack at that point, the rest will be
-  // requested in the GenerateData function
-  typename RegionOfInterestFilterType::InputImageRegionType projRegion;
-  const unsigned int                                        Dimension = this->InputImageDimension;
-  projRegion = m_ResampleImageFilter->GetOutput()->GetLargestPossibleRegion();
-  projRegion.SetSize(Dimension - 1, 1);
-  m_RegionOfInterest->SetRegionOfInterest(projRegion);
-  m_RegionOfInterest->SetInput(m_ResampleImageFilter->GetOutput());
-  m_RegionOfInterest->UpdateOutputInformation();
-
-  m_DiscreteGaussianFilter->SetVariance(pow(m_SigmaZero, 2.0));
-
-  if (!(this->GetInput(2)))
+  if (this->GetInput(2))
   {
-    m_DiscreteGaussianFilter->SetInput(m_RegionOfInterest->GetOutput());
-  }
-  else
-  {
-    m_AttenuationMapMultiplyImageFilter = MultiplyImageFilterType::New();
-    m_AttenuationMapRegionOfInterest = RegionOfInterestFilterType::New();
     m_AttenuationMapResampleImageFilter = ResampleImageFilterType::New();
-    m_AttenuationMapChangeInformation = ChangeInformationFilterType::New();
-    m_AttenuationMapChangeInformation->ChangeOriginOn();
-    m_AttenuationMapChangeInformation->SetReferenceImage(m_DiscreteGaussianFilter->GetOutput());
-    m_AttenuationMapChangeInformation->SetUseReferenceImage(true);
     m_CustomUnaryFilter = CustomUnaryFilterType::New();
 
     // Set Lambda function
@@ -268,30 +224,17 @@ ZengForwardProjectionImageFilter<TInputImage, TOutputImage>::GenerateOutputInfor
     m_AttenuationMapResampleImageFilter->SetInput(m_CustomUnaryFilter->GetOutput());
     m_AttenuationMapResampleImageFilter->SetDefaultPixelValue(1.);
     m_AttenuationMapResampleImageFilter->UpdateOutputInformation();
-
-    m_AttenuationMapRegionOfInterest->SetRegionOfInterest(projRegion);
-    m_AttenuationMapRegionOfInterest->SetInput(m_AttenuationMapResampleImageFilter->GetOutput());
-    m_AttenuationMapRegionOfInterest->UpdateOutputInformation();
-
-    m_AttenuationMapMultiplyImageFilter->SetInput1(m_RegionOfInterest->GetOutput());
-    m_AttenuationMapMultiplyImageFilter->SetInput2(m_AttenuationMapRegionOfInterest->GetOutput());
-    m_DiscreteGaussianFilter->SetInput(m_AttenuationMapMultiplyImageFilter->GetOutput());
   }
 
-  m_MultiplyImageFilter->SetConstant(spacingVolume[2]);
-
-  m_PasteImageFilter->SetSourceImage(m_DiscreteGaussianFilter->GetOutput());
-  m_PasteImageFilter->SetDestinationImage(this->GetInput(0));
-  m_PasteImageFilter->SetSourceRegion(m_DiscreteGaussianFilter->GetOutput()->GetLargestPossibleRegion());
-
-  // Update output information
-  m_PasteImageFilter->UpdateOutputInformation();
-  this->GetOutput()->SetOrigin(m_PasteImageFilter->GetOutput()->GetOrigin());
-  this->GetOutput()->SetSpacing(m_PasteImageFilter->GetOutput()->GetSpacing());
-  this->GetOutput()->SetDirection(m_PasteImageFilter->GetOutput()->GetDirection());
-  this->GetOutput()->SetLargestPossibleRegion(m_PasteImageFilter->GetOutput()->GetLargestPossibleRegion());
+  // The output has the same information as the input stack of projections
+  Superclass::GenerateOutputInformation();
+}
 
-  //  m_ResampleImageFilter->ReleaseDataFlagOn();
+template <class TInputImage, class TOutputImage>
+void
+ZengForwardProjectionImageFilter<TInputImage, TOutputImage>::EnlargeOutputRequestedRegion(itk::DataObject * output)
+{
+  output->SetRequestedRegionToLargestPossibleRegion();
 }
 
 template <class TInputImage, class TOutputImage>
@@ -311,11 +254,30 @@ ZengForwardProjectionImageFilter<TInputImage, TOutputImage>::GenerateData()
     list_angle = geometry->GetGantryAngles();
   }
 
-  typename OuputCPUImageType::Pointer   currentSlice;
-  typename OuputCPUImageType::Pointer   pimg;
-  typename OuputCPUImageType::Pointer   rotatedVolume;
+  this->AllocateOutputs();
+
+  // The projections which are not computed below keep the values of input 0.
+  // Nothing to copy when running in place or when all projections are computed.
+  if (list_angle.size() < projRegion.GetSize(Dimension - 1) &&
+      static_cast<const void *>(this->GetInput(0)->GetBufferPointer()) !=
+        static_cast<const void *>(this->GetOutput()->GetBufferPointer()))
+  {
+    const typename OuputCPUImageType::RegionType outputRegion = this->GetOutput()->GetRequestedRegion();
+    itk::ImageAlgorithm::Copy(this->GetInput(0), this->GetOutput(), outputRegion, outputRegion);
+  }
+
+  // Detector-sized blur, reused for all slices and all projections
+  const typename OuputCPUImageType::SpacingType outputSpacing = m_ResampleImageFilter->GetOutputSpacing();
+  const typename OuputCPUImageType::SizeType    outputSize = m_ResampleImageFilter->GetSize();
+  const itk::SizeValueType                      sliceSize = outputSize[0] * outputSize[1];
+  BlurType                                      blur;
+  blur.SetSliceGeometry(outputSize[0], outputSize[1], outputSpacing[0], outputSpacing[1]);
+  blur.SetMultiThreader(this->GetMultiThreader());
+  std::vector<OutputPixelType> currentSlice(sliceSize);
+
+  const double                          spacingVolume = this->GetInput(1)->GetSpacing()[2];
   typename OuputCPUImageType::IndexType indexSlice{};
-  typename OuputCPUImageType::IndexType indexProjection{};
+  typename OuputCPUImageType::IndexType indexProjection = projRegion.GetIndex();
   PointType                             pointSlice;
   PointType                             centerRotatedVolume;
   PointType                             originRotatedVolume;
@@ -332,115 +294,72 @@ ZengForwardProjectionImageFilter<TInputImage, TOutputImage>::GenerateData()
                                                 geometry->GetProjectionOffsetsX()[nbProjections] * sin(-angle)));
     centerRotatedVolume = m_Transform->GetMatrix() * m_centerVolume;
 
-    // Rotate the input volume
-    this->GetInput(1)->GetBufferPointer();
+    // Rotate the input volume. The output of the resampler is not
+    // disconnected so that its buffer is reused from one angle to the next.
     originRotatedVolume = m_ResampleImageFilter->GetOutputOrigin();
     originRotatedVolume[2] = centerRotatedVolume[2] - m_ResampleImageFilter->GetOutputSpacing()[2] *
                                                         (double)(m_ResampleImageFilter->GetSize()[2] - 1) / 2.0;
     m_ResampleImageFilter->SetOutputOrigin(originRotatedVolume);
     m_ResampleImageFilter->Update();
-    rotatedVolume = m_ResampleImageFilter->GetOutput();
-    rotatedVolume->DisconnectPipeline();
+    const OuputCPUImageType * rotatedVolume = m_ResampleImageFilter->GetOutput();
+    const OutputPixelType *   rotatedVolumeBuffer = rotatedVolume->GetBufferPointer();
     thicknessSlice = rotatedVolume->GetSpacing()[2];
 
-    // Extract slice from the volume starting by the farthest from the detector.
-    typename RegionOfInterestFilterType::InputImageRegionType desiredRegion = rotatedVolume->GetLargestPossibleRegion();
-    unsigned int                                              nbSlice = desiredRegion.GetSize(Dimension - 1);
-    desiredRegion.SetSize(Dimension - 1, 1);
-    desiredRegion.SetIndex(Dimension - 1, nbSlice - 1);
-    indexSlice[2] = nbSlice - 1;
-    m_RegionOfInterest->SetInput(rotatedVolume);
-    m_RegionOfInterest->SetRegionOfInterest(desiredRegion);
-    m_RegionOfInterest->UpdateOutputInformation();
-    m_RegionOfInterest->Update();
-    if (!(this->GetInput(2)))
-    {
-      currentSlice = m_RegionOfInterest->GetOutput();
-    }
-    else
+    // Rotate the attenuation map, i.e., the attenuation factor of each slice
+    const OutputPixelType * rotatedAttenuationBuffer = nullptr;
+    if (this->GetInput(2))
     {
-      typename OuputCPUImageType::Pointer rotatedAttenuation;
       m_AttenuationMapResampleImageFilter->SetOutputOrigin(originRotatedVolume);
       m_AttenuationMapResampleImageFilter->Update();
-      rotatedAttenuation = m_AttenuationMapResampleImageFilter->GetOutput();
-      rotatedAttenuation->DisconnectPipeline();
-      m_AttenuationMapRegionOfInterest->SetInput(rotatedAttenuation);
-      m_AttenuationMapRegionOfInterest->SetRegionOfInterest(desiredRegion);
-      m_AttenuationMapRegionOfInterest->UpdateOutputInformation();
-      m_AttenuationMapMultiplyImageFilter->SetInput1(m_RegionOfInterest->GetOutput());
-      m_AttenuationMapMultiplyImageFilter->SetInput2(m_AttenuationMapRegionOfInterest->GetOutput());
-      m_AttenuationMapMultiplyImageFilter->Update();
-      m_AttenuationMapChangeInformation->SetInput(m_AttenuationMapRegionOfInterest->GetOutput());
-      currentSlice = m_AttenuationMapMultiplyImageFilter->GetOutput();
+      rotatedAttenuationBuffer = m_AttenuationMapResampleImageFilter->GetOutput()->GetBufferPointer();
+    }
+
+    // Start from the slice the farthest from the detector.
+    const unsigned int nbSlice = rotatedVolume->GetLargestPossibleRegion().GetSize(Dimension - 1);
+    indexSlice[2] = nbSlice - 1;
+    const OutputPixelType * slice = rotatedVolumeBuffer + (nbSlice - 1) * sliceSize;
+    for (itk::SizeValueType p = 0; p < sliceSize; p++)
+      currentSlice[p] = slice[p];
+    if (rotatedAttenuationBuffer)
+    {
+      const OutputPixelType * attenuationSlice = rotatedAttenuationBuffer + (nbSlice - 1) * sliceSize;
+      for (itk::SizeValueType p = 0; p < sliceSize; p++)
+        currentSlice[p] *= attenuationSlice[p];
     }
-    currentSlice->DisconnectPipeline();
-    m_DiscreteGaussianFilter->SetInput(currentSlice);
-    m_ChangeInformation->SetInput(m_RegionOfInterest->GetOutput());
 
     // Compute the distance between the current slice and the detector
     rotatedVolume->TransformIndexToPhysicalPoint(indexSlice, pointSlice);
     dist = geometry->GetSourceToIsocenterDistances()[nbProjections] +
            pointSlice.GetVectorFromOrigin() * m_VectorOrthogonalDetector;
-    int index = 0;
-    for (index = nbSlice - 2; index >= 0; index--)
+    for (int index = nbSlice - 2; index >= 0; index--)
     {
-      if (dist - rotatedVolume->GetSpacing()[2] < 0)
+      if (dist - thicknessSlice < 0)
       {
         break;
       }
       // Compute the variance of the PSF for the current slice
       sigmaSlice = dist * 2. * thicknessSlice * pow(m_Alpha, 2.0) + 2. * thicknessSlice * m_Alpha * m_SigmaZero -
                    pow(m_Alpha, 2.0) * pow(thicknessSlice, 2.0);
-      m_DiscreteGaussianFilter->SetVariance(sigmaSlice);
-
-      // Extract the next slice
-      desiredRegion.SetIndex(Dimension - 1, index);
-      m_RegionOfInterest->SetRegionOfInterest(desiredRegion);
-      m_RegionOfInterest->UpdateOutputInformation();
-
-      // Add the current blur slice with the next
-      m_AddImageFilter->GetOutput()->UpdateOutputInformation();
-      m_AddImageFilter->GetOutput()->PropagateRequestedRegion();
-      m_AddImageFilter->Update();
-      if (!(this->GetInput(2)))
-      {
-        currentSlice = m_AddImageFilter->GetOutput();
-      }
-      else
-      {
-        m_AttenuationMapRegionOfInterest->SetRegionOfInterest(desiredRegion);
-        m_AttenuationMapRegionOfInterest->UpdateOutputInformation();
-        m_AttenuationMapMultiplyImageFilter->SetInput1(m_AddImageFilter->GetOutput());
-        m_AttenuationMapMultiplyImageFilter->SetInput2(m_AttenuationMapChangeInformation->GetOutput());
-        m_AttenuationMapMultiplyImageFilter->Update();
-        currentSlice = m_AttenuationMapMultiplyImageFilter->GetOutput();
-      }
-      currentSlice->DisconnectPipeline();
-      m_DiscreteGaussianFilter->SetInput(currentSlice);
-      dist -= rotatedVolume->GetSpacing()[2];
+
+      // Blur the current slice, add the next one and attenuate
+      const OutputPixelType * attenuationSlice = nullptr;
+      if (rotatedAttenuationBuffer)
+        attenuationSlice = rotatedAttenuationBuffer + index * sliceSize;
+      blur.Blur(currentSlice.data(), sigmaSlice, rotatedVolumeBuffer + index * sliceSize, attenuationSlice);
+      dist -= thicknessSlice;
     }
     // Compute the variance of the PSF for the last slice
     sigmaSlice = pow(m_Alpha * dist + m_SigmaZero, 2.0);
-    m_DiscreteGaussianFilter->SetVariance(sigmaSlice);
-    // Paste the projection in the output volume
-    indexProjection[Dimension - 1] = nbProjections;
-    m_PasteImageFilter->SetSourceRegion(m_DiscreteGaussianFilter->GetOutput()->GetLargestPossibleRegion());
-    m_PasteImageFilter->SetDestinationIndex(indexProjection);
-    m_PasteImageFilter->UpdateLargestPossibleRegion();
-    pimg = m_PasteImageFilter->GetOutput();
+    blur.Blur(currentSlice.data(), sigmaSlice);
 
-    pimg->DisconnectPipeline();
-    m_PasteImageFilter->SetDestinationImage(pimg);
+    // Write the projection in the output stack
+    indexProjection[Dimension - 1] = nbProjections;
+    OutputPixelType * projection =
+      this->GetOutput()->GetBufferPointer() + this->GetOutput()->ComputeOffset(indexProjection);
+    for (itk::SizeValueType p = 0; p < sliceSize; p++)
+      projection[p] = static_cast<OutputPixelType>(currentSlice[p] * spacingVolume);
     nbProjections++;
   }
-  m_MultiplyImageFilter->SetInput(pimg);
-  m_MultiplyImageFilter->UpdateLargestPossibleRegion();
-  pimg = m_MultiplyImageFilter->GetOutput();
-  pimg->DisconnectPipeline();
-  this->GetOutput()->SetPixelContainer(pimg->GetPixelContainer());
-  this->GetOutput()->CopyInformation(pimg);
-  this->GetOutput()->SetBufferedRegion(pimg->GetBufferedRegion());
-  this->GetOutput()->SetRequestedRegion(pimg->GetRequestedRegion());
 }
 
 } // end namespace rtk
@@ -96,6 +96,97 @@ BoxShape ::IsIntersectedByRay(const PointType &  rayOrigin,
   return ApplyClipPlanes(rayOrigin, rayDirection, infDist, supDist);
 }
 
+void
+BoxShape ::AreInside(const PointType * points, unsigned int n, bool * inside) const
+{
+  // Transform of the box computed once for all points
+  RotationMatrixType dirt;
+  dirt = m_Direction.GetTranspose();
+  const PointType min = dirt * m_BoxMin;
+  const PointType max = dirt * m_BoxMax;
+  for (unsigned int k = 0; k < n; k++)
+  {
+    const PointType t = dirt * points[k];
+    inside[k] = !(t[0] < min[0] || t[0] > max[0] || t[1] < min[1] || t[1] > max[1] || t[2] < min[2] || t[2] > max[2]);
+  }
+  ApplyClipPlanes(points, n, inside);
+}
+
+void
+BoxShape ::AreIntersectedByRays(const PointType *  rayOrigins,
+                                const VectorType * rayDirections,
+                                unsigned int       n,
+                                ScalarType *       infDist,
+                                ScalarType *       supDist,
+                                bool *             intersected) const
+{
+  // Transform of the box computed once for all rays, see IsIntersectedByRay
+  RotationMatrixType dirt;
+  dirt = m_Direction.GetTranspose();
+  PointType min = dirt * m_BoxMin;
+  PointType max = dirt * m_BoxMax;
+  for (unsigned int i = 0; i < Dimension; i++)
+    if (min[i] > max[i])
+      std::swap(min[i], max[i]);
+
+  for (unsigned int k = 0; k < n; k++)
+  {
+    const PointType  org = dirt * rayOrigins[k];
+    const VectorType dir = dirt * rayDirections[k];
+    ScalarType       inf = itk::NumericTraits<ScalarType>::NonpositiveMin();
+    ScalarType       sup = itk::NumericTraits<ScalarType>::max();
+    bool             hit = true;
+    for (unsigned int i = 0; i < Dimension; i++)
+    {
+      if (dir[i] == itk::NumericTraits<ScalarType>::ZeroValue() && (org[i] < min[i] || org[i] > max[i]))
+        hit = false;
+      const ScalarType invRayDir = 1 / dir[i];
+      ScalarType       T1 = (min[i] - org[i]) * invRayDir;
+      ScalarType       T2 = (max[i] - org[i]) * invRayDir;
+      if (T1 > T2)
+        std::swap(T1, T2);
+      inf = std::max(T1, inf);
+      sup = std::min(T2, sup);
+      hit = hit && !(inf > sup) && !(sup < itk::NumericTraits<ScalarType>::ZeroValue());
+    }
+    infDist[k] = inf;
+    supDist[k] = sup;
+    intersected[k] = hit;
+  }
+  ApplyClipPlanes(rayOrigins, rayDirections, n, infDist, supDist, intersected);
+}
+
+bool
+BoxShape ::GetBoundingBox(PointType & inf, PointType & sup) const
+{
+  // Corners in the coordinate system aligned with the box, as in IsInside
+  RotationMatrixType dirt;
+  dirt = m_Direction.GetTranspose();
+  PointType min = dirt * m_BoxMin;
+  PointType max = dirt * m_BoxMax;
+  for (unsigned int i = 0; i < Dimension; i++)
+    if (min[i] > max[i])
+      std::swap(min[i], max[i]);
+
+  // Bounds of the 8 corners back in the world coordinate system
+  const RotationMatrixType invDirt(dirt.GetInverse());
+  inf.Fill(itk::NumericTraits<ScalarType>::max());
+  sup.Fill(itk::NumericTraits<ScalarType>::NonpositiveMin());
+  for (unsigned int c = 0; c < (1u << Dimension); c++)
+  {
+    PointType corner;
+    for (unsigned int i = 0; i < Dimension; i++)
+      corner[i] = ((c >> i) & 1) ? max[i] : min[i];
+    corner = invDirt * corner;
+    for (unsigned int i = 0; i < Dimension; i++)
+    {
+      inf[i] = std::min(inf[i], corner[i]);
+      sup[i] = std::max(sup[i], corner[i]);
+    }
+  }
+  return true;
+}
+
 void
 BoxShape ::Rescale(const VectorType & r)
 {
@@ -16,6 +16,8 @@
  *
  *=========================================================================*/
 
+#include <algorithm>
+
 #include "rtkConvexShape.h"
 
 namespace rtk
@@ -40,6 +42,31 @@ ConvexShape ::IsIntersectedByRay(const PointType & /*rayOrigin*/,
   return false;
 }
 
+void
+ConvexShape ::AreInside(const PointType * points, unsigned int n, bool * inside) const
+{
+  for (unsigned int k = 0; k < n; k++)
+    inside[k] = this->IsInside(points[k]);
+}
+
+void
+ConvexShape ::AreIntersectedByRays(const PointType *  rayOrigins,
+                                   const VectorType * rayDirections,
+                                   unsigned int       n,
+                                   ScalarType *       infDist,
+                                   ScalarType *       supDist,
+                                   bool *             intersected) const
+{
+  for (unsigned int k = 0; k < n; k++)
+    intersected[k] = this->IsIntersectedByRay(rayOrigins[k], rayDirections[k], infDist[k], supDist[k]);
+}
+
+bool
+ConvexShape ::GetBoundingBox(PointType & /*inf*/, PointType & /*sup*/) const
+{
+  return false;
+}
+
 void
 ConvexShape ::Rescale(const VectorType & r)
 {
@@ -152,4 +179,56 @@ ConvexShape ::ApplyClipPlanes(const PointType & point) const
   return true;
 }
 
+void
+ConvexShape ::ApplyClipPlanes(const PointType *  rayOrigins,
+                              const VectorType * rayDirections,
+                              unsigned int       n,
+                              ScalarType *       infDist,
+                              ScalarType *       supDist,
+                              bool *             intersected) const
+{
+  // Same computation as the single ray version, one plane at a time
+  constexpr ScalarType zero = itk::NumericTraits<ScalarType>::ZeroValue();
+  for (size_t i = 0; i < m_PlaneDirections.size(); i++)
+  {
+    const VectorType & planeDir = m_PlaneDirections[i];
+    const ScalarType   planePos = m_PlanePositions[i];
+    for (unsigned int k = 0; k < n; k++)
+    {
+      if (!intersected[k])
+        continue;
+      const ScalarType rayDirPlaneDir = rayDirections[k] * planeDir;
+      const ScalarType rayOrgPlaneDir = rayOrigins[k].GetVectorFromOrigin() * planeDir;
+      if (rayDirPlaneDir == zero)
+      {
+        intersected[k] = rayOrgPlaneDir < planePos;
+        continue;
+      }
+      const ScalarType planeDist = (planePos - rayOrgPlaneDir) / rayDirPlaneDir;
+      if (rayDirPlaneDir >= zero)
+      {
+        intersected[k] = planeDist > infDist[k];
+        supDist[k] = std::min(supDist[k], planeDist);
+      }
+      else
+      {
+        intersected[k] = planeDist < supDist[k];
+        infDist[k] = std::max(infDist[k], planeDist);
+      }
+    }
+  }
+}
+
+void
+ConvexShape ::ApplyClipPlanes(const PointType * points, unsigned int n, bool * inside) const
+{
+  for (size_t i = 0; i < m_PlaneDirections.size(); i++)
+  {
+    const VectorType & planeDir = m_PlaneDirections[i];
+    const ScalarType   planePos = m_PlanePositions[i];
+    for (unsigned int k = 0; k < n; k++)
+      inside[k] = inside[k] && points[k].GetVectorFromOrigin() * planeDir < planePos;
+  }
+}
+
 } // namespace rtk
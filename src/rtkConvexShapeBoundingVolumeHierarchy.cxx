@@ -0,0 +1,201 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "rtkConvexShapeBoundingVolumeHierarchy.h"
+
+namespace rtk
+{
+
+void
+ConvexShapeBoundingVolumeHierarchy ::SetConvexShapes(const ConvexShapeVector & shapes)
+{
+  m_ConvexShapes = shapes;
+  m_ShapeInf.resize(shapes.size());
+  m_ShapeSup.resize(shapes.size());
+  m_Bounded.clear();
+  m_Unbounded.clear();
+  m_Nodes.clear();
+  for (unsigned int s = 0; s < shapes.size(); s++)
+  {
+    if (!shapes[s]->GetBoundingBox(m_ShapeInf[s], m_ShapeSup[s]))
+    {
+      m_Unbounded.push_back(s);
+      continue;
+    }
+
+    // Pad the box to be robust to rounding errors for points on the surface
+    for (unsigned int i = 0; i < Dimension; i++)
+    {
+      const double pad = 1e-9 * (1. + std::abs(m_ShapeInf[s][i]) + std::abs(m_ShapeSup[s][i]));
+      m_ShapeInf[s][i] -= pad;
+      m_ShapeSup[s][i] += pad;
+    }
+    m_Bounded.push_back(s);
+  }
+
+  if (!m_Bounded.empty())
+    this->Build(0, static_cast<unsigned int>(m_Bounded.size()));
+}
+
+unsigned int
+ConvexShapeBoundingVolumeHierarchy ::Build(unsigned int first, unsigned int last)
+{
+  constexpr unsigned int maxLeafSize = 4;
+
+  // Bounds of the shapes and of their centers
+  Node      node{};
+  PointType centerInf, centerSup;
+  node.Inf.Fill(itk::NumericTraits<double>::max());
+  node.Sup.Fill(itk::NumericTraits<double>::NonpositiveMin());
+  centerInf = node.Inf;
+  centerSup = node.Sup;
+  for (unsigned int k = first; k < last; k++)
+  {
+    const unsigned int s = m_Bounded[k];
+    for (unsigned int i = 0; i < Dimension; i++)
+    {
+      node.Inf[i] = std::min(node.Inf[i], m_ShapeInf[s][i]);
+      node.Sup[i] = std::max(node.Sup[i], m_ShapeSup[s][i]);
+      const double center = 0.5 * (m_ShapeInf[s][i] + m_ShapeSup[s][i]);
+      centerInf[i] = std::min(centerInf[i], center);
+      centerSup[i] = std::max(centerSup[i], center);
+    }
+  }
+
+  unsigned int axis = 0;
+  for (unsigned int i = 1; i < Dimension; i++)
+    if (centerSup[i] - centerInf[i] > centerSup[axis] - centerInf[axis])
+      axis = i;
+
+  const auto nodeIndex = static_cast<unsigned int>(m_Nodes.size());
+  if (last - first <= maxLeafSize || centerSup[axis] == centerInf[axis])
+  {
+    node.First = first;
+    node.Count = last - first;
+    m_Nodes.push_back(node);
+    return nodeIndex;
+  }
+
+  // Median split of the centers along the axis of largest extent
+  const unsigned int mid = first + (last - first) / 2;
+  std::nth_element(m_Bounded.begin() + first,
+                   m_Bounded.begin() + mid,
+                   m_Bounded.begin() + last,
+                   [this, axis](unsigned int a, unsigned int b) {
+                     return m_ShapeInf[a][axis] + m_ShapeSup[a][axis] < m_ShapeInf[b][axis] + m_ShapeSup[b][axis];
+                   });
+  m_Nodes.push_back(node);
+  this->Build(first, mid);
+  const unsigned int right = this->Build(mid, last);
+  m_Nodes[nodeIndex].Right = right;
+  return nodeIndex;
+}
+
+bool
+ConvexShapeBoundingVolumeHierarchy ::IsLineIntersectingBox(const PointType &  origin,
+                                                           const VectorType & direction,
+                                                           const PointType &  inf,
+                                                           const PointType &  sup)
+{
+  double tmin = itk::NumericTraits<double>::NonpositiveMin();
+  double tmax = itk::NumericTraits<double>::max();
+  for (unsigned int i = 0; i < Dimension; i++)
+  {
+    if (direction[i] == 0.)
+    {
+      if (origin[i] < inf[i] || origin[i] > sup[i])
+        return false;
+      continue;
+    }
+    double t1 = (inf[i] - origin[i]) / direction[i];
+    double t2 = (sup[i] - origin[i]) / direction[i];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tmin = std::max(tmin, t1);
+    tmax = std::min(tmax, t2);
+    if (tmin > tmax)
+      return false;
+  }
+  return true;
+}
+
+template <class TPredicate>
+void
+ConvexShapeBoundingVolumeHierarchy ::Find(const TPredicate & isBoxSelected, IndexVectorType & indices) const
+{
+  indices = m_Unbounded;
+  if (!m_Nodes.empty())
+  {
+    unsigned int stack[64];
+    unsigned int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize)
+    {
+      const Node & node = m_Nodes[stack[--stackSize]];
+      if (!isBoxSelected(node.Inf, node.Sup))
+        continue;
+      if (node.Count)
+      {
+        for (unsigned int k = node.First; k < node.First + node.Count; k++)
+        {
+          const unsigned int s = m_Bounded[k];
+          if (node.Count == 1 || isBoxSelected(m_ShapeInf[s], m_ShapeSup[s]))
+            indices.push_back(s);
+        }
+      }
+      else
+      {
+        stack[stackSize++] = node.Right;
+        stack[stackSize++] = static_cast<unsigned int>(&node - m_Nodes.data()) + 1;
+      }
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+}
+
+void
+ConvexShapeBoundingVolumeHierarchy ::FindShapesAlongLine(const PointType &  origin,
+                                                         const VectorType & direction,
+                                                         IndexVectorType &  indices) const
+{
+  this->Find(
+    [&origin, &direction](const PointType & inf, const PointType & sup) {
+      return IsLineIntersectingBox(origin, direction, inf, sup);
+    },
+    indices);
+}
+
+void
+ConvexShapeBoundingVolumeHierarchy ::FindShapesInBox(const PointType & inf,
+                                                     const PointType & sup,
+                                                     IndexVectorType & indices) const
+{
+  this->Find(
+    [&inf, &sup](const PointType & boxInf, const PointType & boxSup) {
+      for (unsigned int i = 0; i < Dimension; i++)
+        if (boxSup[i] < inf[i] || boxInf[i] > sup[i])
+          return false;
+      return true;
+    },
+    indices);
+}
+
+} // end namespace rtk
@@ -18,6 +18,10 @@
 #include "rtkGlobalResourceProbe.h"
 #include "itkObjectFactory.h"
 
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
 namespace rtk
 {
 GlobalResourceProbe::Pointer GlobalResourceProbe::m_Instance = nullptr;
@@ -25,12 +29,30 @@ GlobalResourceProbe::Pointer GlobalResourceProbe::m_Instance = nullptr;
 /**
  * Prompting off by default
  */
-GlobalResourceProbe ::GlobalResourceProbe() { m_Verbose = false; }
+GlobalResourceProbe ::GlobalResourceProbe()
+{
+  m_Verbose = false;
+  m_TraceOrigin = std::chrono::steady_clock::now();
+
+  // Tracing on request through the environment
+  const char * traceFileName = std::getenv("RTK_TRACE_FILE");
+  if (traceFileName && traceFileName[0] != '\0')
+  {
+    m_TraceFileName = traceFileName;
+    m_Tracing = true;
+  }
+}
 
 GlobalResourceProbe ::~GlobalResourceProbe()
 {
   if (m_Verbose)
     this->Report(std::cout);
+  if (!m_TraceFileName.empty())
+  {
+    std::ofstream traceFile(m_TraceFileName.c_str());
+    if (traceFile)
+      this->WriteTrace(traceFile);
+  }
   this->Clear();
 }
 
@@ -40,6 +62,7 @@ GlobalResourceProbe ::PrintSelf(std::ostream & os, Indent indent) const
   Superclass::PrintSelf(os, indent);
 
   os << indent << "GlobalResourceProbe (single instance): " << (void *)GlobalResourceProbe::m_Instance << std::endl;
+  os << indent << "Tracing: " << m_Tracing.load() << std::endl;
 }
 
 /**
@@ -125,6 +148,96 @@ GlobalResourceProbe ::Clear()
   m_Mutex.lock();
   m_ResourceProbesCollector.Clear();
   m_Watchers.clear();
+  for (auto & traceBuffer : m_TraceBuffers)
+    traceBuffer->Count.store(0);
   m_Mutex.unlock();
 }
+
+double
+GlobalResourceProbe ::GetTraceTime() const
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_TraceOrigin).count();
+}
+
+void
+GlobalResourceProbe ::TraceBegin(const char * name, const char * category, const void * object)
+{
+  if (m_Tracing.load(std::memory_order_relaxed))
+    this->AddTraceEvent({ name, category, object, this->GetTraceTime(), 0., -1, 'B' });
+}
+
+void
+GlobalResourceProbe ::TraceEnd(const char * name, const char * category, const void * object)
+{
+  if (m_Tracing.load(std::memory_order_relaxed))
+    this->AddTraceEvent({ name, category, object, this->GetTraceTime(), 0., -1, 'E' });
+}
+
+void
+GlobalResourceProbe ::TraceComplete(const char * name, const char * category, double begin, long long value)
+{
+  if (m_Tracing.load(std::memory_order_relaxed))
+    this->AddTraceEvent({ name, category, nullptr, begin, this->GetTraceTime() - begin, value, 'X' });
+}
+
+void
+GlobalResourceProbe ::AddTraceEvent(const TraceEvent & event)
+{
+  // The buffer of each thread is created on its first event, the only time
+  // the mutex is locked
+  thread_local TraceBuffer *               buffer = nullptr;
+  thread_local const GlobalResourceProbe * bufferOwner = nullptr;
+  if (bufferOwner != this)
+  {
+    m_Mutex.lock();
+    m_TraceBuffers.push_back(std::make_unique<TraceBuffer>());
+    buffer = m_TraceBuffers.back().get();
+    buffer->Events.resize(TraceBufferSize);
+    buffer->ThreadIndex = static_cast<unsigned int>(m_TraceBuffers.size() - 1);
+    bufferOwner = this;
+    m_Mutex.unlock();
+  }
+
+  const size_t count = buffer->Count.load(std::memory_order_relaxed);
+  buffer->Events[count % TraceBufferSize] = event;
+  buffer->Count.store(count + 1, std::memory_order_release);
+}
+
+void
+GlobalResourceProbe ::WriteTrace(std::ostream & os) const
+{
+  const std::ios::fmtflags flags = os.flags();
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\":[";
+  bool first = true;
+
+  // Threads recording their first event add a buffer to the list
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  for (const auto & traceBuffer : m_TraceBuffers)
+  {
+    const unsigned int tid = traceBuffer->ThreadIndex;
+    os << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << tid
+       << ",\"args\":{\"name\":\"Thread " << tid << "\"}}";
+    first = false;
+
+    // Only the last TraceBufferSize events are available
+    const size_t count = traceBuffer->Count.load(std::memory_order_acquire);
+    for (size_t i = (count > TraceBufferSize) ? count - TraceBufferSize : 0; i < count; i++)
+    {
+      const TraceEvent & e = traceBuffer->Events[i % TraceBufferSize];
+      os << ",\n{\"name\":\"" << e.Name << "\",\"cat\":\"" << e.Category << "\",\"ph\":\"" << e.Phase
+         << "\",\"ts\":" << e.Timestamp << ",\"pid\":0,\"tid\":" << tid;
+      if (e.Phase == 'X')
+        os << ",\"dur\":" << e.Duration;
+      os << ",\"args\":{";
+      if (e.Object)
+        os << "\"object\":\"" << e.Object << "\"";
+      if (e.Value >= 0)
+        os << (e.Object ? "," : "") << "\"value\":" << e.Value;
+      os << "}}";
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+  os.flags(flags);
+}
 } // end namespace rtk
@@ -66,6 +66,30 @@ IntersectionOfConvexShapes ::IsIntersectedByRay(const PointType &  rayOrigin,
   return true;
 }
 
+bool
+IntersectionOfConvexShapes ::GetBoundingBox(PointType & inf, PointType & sup) const
+{
+  bool bounded = false;
+  for (const auto & convexShape : m_ConvexShapes)
+  {
+    PointType shapeInf, shapeSup;
+    if (!convexShape->GetBoundingBox(shapeInf, shapeSup))
+      continue;
+    for (unsigned int i = 0; i < Dimension; i++)
+    {
+      inf[i] = (bounded) ? std::max(inf[i], shapeInf[i]) : shapeInf[i];
+      sup[i] = (bounded) ? std::min(sup[i], shapeSup[i]) : shapeSup[i];
+    }
+    bounded = true;
+  }
+
+  // Empty intersection, collapse the box
+  if (bounded)
+    for (unsigned int i = 0; i < Dimension; i++)
+      sup[i] = std::max(inf[i], sup[i]);
+  return bounded;
+}
+
 void
 IntersectionOfConvexShapes ::Rescale(const VectorType & r)
 {
@@ -16,8 +16,14 @@
  *
  *=========================================================================*/
 
+#include <algorithm>
+#include <cmath>
+
 #include "rtkQuadricShape.h"
 
+#include <vnl/vnl_det.h>
+#include <vnl/vnl_inverse.h>
+
 namespace rtk
 {
 
@@ -185,6 +191,118 @@ QuadricShape ::IsIntersectedByRay(const PointType &  rayOrigin,
   return ApplyClipPlanes(rayOrigin, rayDirection, infDist, supDist);
 }
 
+void
+QuadricShape ::AreInside(const PointType * points, unsigned int n, bool * inside) const
+{
+  for (unsigned int k = 0; k < n; k++)
+  {
+    const PointType & point = points[k];
+    ScalarType        QuadricEllip = m_A * point[0] * point[0] + m_B * point[1] * point[1] + m_C * point[2] * point[2] +
+                              m_D * point[0] * point[1] + m_E * point[0] * point[2] + m_F * point[1] * point[2] +
+                              m_G * point[0] + m_H * point[1] + m_I * point[2] + m_J;
+    inside[k] = (QuadricEllip <= itk::NumericTraits<ScalarType>::ZeroValue());
+  }
+  ApplyClipPlanes(points, n, inside);
+}
+
+void
+QuadricShape ::AreIntersectedByRays(const PointType *  rayOrigins,
+                                    const VectorType * rayDirections,
+                                    unsigned int       n,
+                                    ScalarType *       infDist,
+                                    ScalarType *       supDist,
+                                    bool *             intersected) const
+{
+  constexpr ScalarType        zero = itk::NumericTraits<ScalarType>::ZeroValue();
+  static constexpr ScalarType eps = 1e5 * itk::NumericTraits<ScalarType>::epsilon();
+  constexpr unsigned int      chunkSize = 64;
+  bool                        fallback[chunkSize];
+
+  for (unsigned int first = 0; first < n; first += chunkSize)
+  {
+    const unsigned int last = std::min(n, first + chunkSize);
+
+    // Branchless computation of the two intersections with the same
+    // expressions as IsIntersectedByRay. The rays which miss the quadric and
+    // those for which the quadric is the segment between the intersections
+    // are handled here, the other ones are flagged for the fallback.
+    for (unsigned int k = first; k < last; k++)
+    {
+      const PointType &  rayOrigin = rayOrigins[k];
+      const VectorType & rayDirection = rayDirections[k];
+      ScalarType         Aq = m_A * rayDirection[0] * rayDirection[0] + m_B * rayDirection[1] * rayDirection[1] +
+                      m_C * rayDirection[2] * rayDirection[2] + m_D * rayDirection[0] * rayDirection[1] +
+                      m_E * rayDirection[0] * rayDirection[2] + m_F * rayDirection[1] * rayDirection[2];
+      ScalarType Bq = 2 * (m_A * rayOrigin[0] * rayDirection[0] + m_B * rayOrigin[1] * rayDirection[1] +
+                           m_C * rayOrigin[2] * rayDirection[2]) +
+                      m_D * (rayOrigin[0] * rayDirection[1] + rayOrigin[1] * rayDirection[0]) +
+                      m_E * (rayOrigin[2] * rayDirection[0] + rayOrigin[0] * rayDirection[2]) +
+                      m_F * (rayOrigin[1] * rayDirection[2] + rayOrigin[2] * rayDirection[1]) + m_G * rayDirection[0] +
+                      m_H * rayDirection[1] + m_I * rayDirection[2];
+      ScalarType Cq = m_A * rayOrigin[0] * rayOrigin[0] + m_B * rayOrigin[1] * rayOrigin[1] +
+                      m_C * rayOrigin[2] * rayOrigin[2] + m_D * rayOrigin[0] * rayOrigin[1] +
+                      m_E * rayOrigin[0] * rayOrigin[2] + m_F * rayOrigin[1] * rayOrigin[2] + m_G * rayOrigin[0] +
+                      m_H * rayOrigin[1] + m_I * rayOrigin[2] + m_J;
+      ScalarType discriminant = Bq * Bq - 4 * Aq * Cq;
+      ScalarType sqrtDiscriminant = std::sqrt(std::max(discriminant, zero));
+      ScalarType t1 = (-Bq - sqrtDiscriminant) / (2 * Aq);
+      ScalarType t2 = (-Bq + sqrtDiscriminant) / (2 * Aq);
+      infDist[k] = std::min(t1, t2);
+      supDist[k] = std::max(t1, t2);
+
+      const bool twoRoots = Aq != zero && std::abs(discriminant) > eps;
+      const bool miss = twoRoots && discriminant < zero && Cq > zero;
+      intersected[k] = twoRoots && discriminant > zero && !(Cq * supDist[k] * infDist[k] < zero);
+      fallback[k - first] = !miss && !intersected[k];
+    }
+    ApplyClipPlanes(rayOrigins + first, rayDirections + first, last - first, infDist + first, supDist + first,
+                    intersected + first);
+
+    // Rare cases, i.e., tangent rays, rays along the quadric or half lines
+    for (unsigned int k = first; k < last; k++)
+    {
+      if (fallback[k - first])
+        intersected[k] = QuadricShape::IsIntersectedByRay(rayOrigins[k], rayDirections[k], infDist[k], supDist[k]);
+    }
+  }
+}
+
+bool
+QuadricShape ::GetBoundingBox(PointType & inf, PointType & sup) const
+{
+  // Symmetric matrix Q of the quadratic form, the quadric being
+  // x'Qx + b'x + J <= 0 with b = (G, H, I)
+  vnl_matrix_fixed<ScalarType, Dimension, Dimension> q;
+  q(0, 0) = m_A;
+  q(1, 1) = m_B;
+  q(2, 2) = m_C;
+  q(0, 1) = q(1, 0) = 0.5 * m_D;
+  q(0, 2) = q(2, 0) = 0.5 * m_E;
+  q(1, 2) = q(2, 1) = 0.5 * m_F;
+
+  // Sylvester's criterion: bounded if and only if Q is positive definite
+  constexpr ScalarType zero = itk::NumericTraits<ScalarType>::ZeroValue();
+  if (q(0, 0) <= zero || q(0, 0) * q(1, 1) - q(0, 1) * q(1, 0) <= zero || vnl_det(q) <= zero)
+    return false;
+
+  // With c = -Q^-1 b / 2 the center, the quadric is (x-c)'Q(x-c) <= r with
+  // r = c'Qc - J and its half extent along axis i is sqrt(r (Q^-1)_ii).
+  const vnl_matrix_fixed<ScalarType, Dimension, Dimension> qinv = vnl_inverse(q);
+  vnl_vector_fixed<ScalarType, Dimension>                  b;
+  b[0] = m_G;
+  b[1] = m_H;
+  b[2] = m_I;
+  const vnl_vector_fixed<ScalarType, Dimension> c = -0.5 * (qinv * b);
+  const ScalarType                              r = std::max(zero, dot_product(c, q * c) - m_J);
+  for (unsigned int i = 0; i < Dimension; i++)
+  {
+    const ScalarType halfExtent = std::sqrt(r * qinv(i, i));
+    inf[i] = c[i] - halfExtent;
+    sup[i] = c[i] + halfExtent;
+  }
+  return true;
+}
+
 void
 QuadricShape ::Rescale(const VectorType & r)
 {
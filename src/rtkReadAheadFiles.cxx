@@ -0,0 +1,51 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "rtkReadAheadFiles.h"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace rtk
+{
+
+void
+ReadAheadFiles(const std::vector<std::string> & fileNames, size_t first, size_t last)
+{
+#if !defined(_WIN32) && defined(POSIX_FADV_WILLNEED)
+  last = std::min(last, fileNames.size());
+  for (size_t i = first; i < last; i++)
+  {
+    int fd = open(fileNames[i].c_str(), O_RDONLY);
+    if (fd < 0)
+      continue;
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+  }
+#else
+  (void)fileNames;
+  (void)first;
+  (void)last;
+#endif
+}
+
+} // namespace rtk
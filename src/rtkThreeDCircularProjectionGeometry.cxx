@@ -25,6 +25,7 @@
 
 #include <itkCenteredEuler3DTransform.h>
 #include <itkEuler3DTransform.h>
+#include <itkMultiThreaderBase.h>
 
 namespace rtk
 {
@@ -86,7 +87,24 @@ ThreeDCircularProjectionGeometry::AddProjectionInRadians(const double sid,
                                                          const double sourceOffsetX,
                                                          const double sourceOffsetY)
 {
-  // Check parallel / divergent projections consistency
+  this->CheckParallelOrDivergent(sdd);
+  this->AppendProjection(
+    sid,
+    sdd,
+    gantryAngle,
+    projOffsetX,
+    projOffsetY,
+    outOfPlaneAngle,
+    inPlaneAngle,
+    sourceOffsetX,
+    sourceOffsetY,
+    ComputeProjectionMatrices(
+      sid, sdd, gantryAngle, projOffsetX, projOffsetY, outOfPlaneAngle, inPlaneAngle, sourceOffsetX, sourceOffsetY));
+}
+
+void
+ThreeDCircularProjectionGeometry::CheckParallelOrDivergent(const double sdd) const
+{
   if (!m_GantryAngles.empty())
   {
     if (sdd == 0. && m_SourceToDetectorDistances[0] != 0.)
@@ -100,7 +118,63 @@ ThreeDCircularProjectionGeometry::AddProjectionInRadians(const double sid,
         << "Cannot add a divergent projection in a 3D geometry object containing parallel projections");
     }
   }
+}
+
+ThreeDCircularProjectionGeometry::ProjectionMatrices
+ThreeDCircularProjectionGeometry::ComputeProjectionMatrices(const double sid,
+                                                            const double sdd,
+                                                            const double gantryAngle,
+                                                            const double projOffsetX,
+                                                            const double projOffsetY,
+                                                            const double outOfPlaneAngle,
+                                                            const double inPlaneAngle,
+                                                            const double sourceOffsetX,
+                                                            const double sourceOffsetY)
+{
+  ProjectionMatrices m;
+
+  // Compute sub-matrices
+  m.ProjectionTranslation =
+    ComputeTranslationHomogeneousMatrix(sourceOffsetX - projOffsetX, sourceOffsetY - projOffsetY);
+  m.Magnification = ComputeProjectionMagnificationMatrix(-sdd, -sid);
+  m.Rotation = ComputeRotationHomogeneousMatrix(-outOfPlaneAngle, -gantryAngle, -inPlaneAngle);
+  m.SourceTranslation = ComputeTranslationHomogeneousMatrix(-sourceOffsetX, -sourceOffsetY, 0.);
+  m.Matrix = m.ProjectionTranslation.GetVnlMatrix() * m.Magnification.GetVnlMatrix() *
+             m.SourceTranslation.GetVnlMatrix() * m.Rotation.GetVnlMatrix();
 
+  // Calculate source angle
+  VectorType z;
+  z.Fill(0.);
+  z[2] = 1.;
+  HomogeneousVectorType sph;
+  sph[0] = sourceOffsetX;
+  sph[1] = sourceOffsetY;
+  sph[2] = sid;
+  sph[3] = 1.;
+  sph.SetVnlVector(m.Rotation.GetInverse() * sph.GetVnlVector());
+  sph[1] = 0.; // Project position to central plane
+  VectorType sp(sph.data());
+  sp.Normalize();
+  double a = acos(sp * z);
+  if (sp[0] > 0.)
+    a = 2. * itk::Math::pi - a;
+  m.SourceAngle = ConvertAngleBetween0And2PIRadians(a);
+
+  return m;
+}
+
+void
+ThreeDCircularProjectionGeometry::AppendProjection(const double               sid,
+                                                   const double               sdd,
+                                                   const double               gantryAngle,
+                                                   const double               projOffsetX,
+                                                   const double               projOffsetY,
+                                                   const double               outOfPlaneAngle,
+                                                   const double               inPlaneAngle,
+                                                   const double               sourceOffsetX,
+                                                   const double               sourceOffsetY,
+                                                   const ProjectionMatrices & matrices)
+{
   // Detector orientation parameters
   m_GantryAngles.push_back(ConvertAngleBetween0And2PIRadians(gantryAngle));
   m_OutOfPlaneAngles.push_back(ConvertAngleBetween0And2PIRadians(outOfPlaneAngle));
@@ -116,32 +190,12 @@ ThreeDCircularProjectionGeometry::AddProjectionInRadians(const double sid,
   m_ProjectionOffsetsX.push_back(projOffsetX);
   m_ProjectionOffsetsY.push_back(projOffsetY);
 
-  // Compute sub-matrices
-  AddProjectionTranslationMatrix(
-    ComputeTranslationHomogeneousMatrix(sourceOffsetX - projOffsetX, sourceOffsetY - projOffsetY));
-  AddMagnificationMatrix(ComputeProjectionMagnificationMatrix(-sdd, -sid));
-  AddRotationMatrix(ComputeRotationHomogeneousMatrix(-outOfPlaneAngle, -gantryAngle, -inPlaneAngle));
-  AddSourceTranslationMatrix(ComputeTranslationHomogeneousMatrix(-sourceOffsetX, -sourceOffsetY, 0.));
-
-  Superclass::MatrixType matrix;
-  matrix = this->GetProjectionTranslationMatrices().back().GetVnlMatrix() *
-           this->GetMagnificationMatrices().back().GetVnlMatrix() *
-           this->GetSourceTranslationMatrices().back().GetVnlMatrix() *
-           this->GetRotationMatrices().back().GetVnlMatrix();
-  this->AddMatrix(matrix);
-
-  // Calculate source angle
-  VectorType z;
-  z.Fill(0.);
-  z[2] = 1.;
-  HomogeneousVectorType sph = GetSourcePosition(m_GantryAngles.size() - 1);
-  sph[1] = 0.; // Project position to central plane
-  VectorType sp(sph.data());
-  sp.Normalize();
-  double a = acos(sp * z);
-  if (sp[0] > 0.)
-    a = 2. * itk::Math::pi - a;
-  m_SourceAngles.push_back(ConvertAngleBetween0And2PIRadians(a));
+  AddProjectionTranslationMatrix(matrices.ProjectionTranslation);
+  AddMagnificationMatrix(matrices.Magnification);
+  AddRotationMatrix(matrices.Rotation);
+  AddSourceTranslationMatrix(matrices.SourceTranslation);
+  this->AddMatrix(matrices.Matrix);
+  m_SourceAngles.push_back(matrices.SourceAngle);
 
   // Default collimation (uncollimated)
   m_CollimationUInf.push_back(std::numeric_limits<double>::max());
@@ -376,6 +430,120 @@ ThreeDCircularProjectionGeometry::AddProjection(const HomogeneousProjectionMatri
   return true;
 }
 
+void
+ThreeDCircularProjectionGeometry::AddProjections(const std::vector<double> & sids,
+                                                 const std::vector<double> & sdds,
+                                                 const std::vector<double> & gantryAngles,
+                                                 const std::vector<double> & projOffsetsX,
+                                                 const std::vector<double> & projOffsetsY,
+                                                 const std::vector<double> & outOfPlaneAngles,
+                                                 const std::vector<double> & inPlaneAngles,
+                                                 const std::vector<double> & sourceOffsetsX,
+                                                 const std::vector<double> & sourceOffsetsY)
+{
+  const double degreesToRadians = std::atan(1.0) / 45.0;
+  const auto   toRadians = [degreesToRadians](std::vector<double> v) {
+    for (double & a : v)
+      a *= degreesToRadians;
+    return v;
+  };
+  this->AddProjectionsInRadians(sids,
+                                sdds,
+                                toRadians(gantryAngles),
+                                projOffsetsX,
+                                projOffsetsY,
+                                toRadians(outOfPlaneAngles),
+                                toRadians(inPlaneAngles),
+                                sourceOffsetsX,
+                                sourceOffsetsY);
+}
+
+void
+ThreeDCircularProjectionGeometry::AddProjectionsInRadians(const std::vector<double> & sids,
+                                                          const std::vector<double> & sdds,
+                                                          const std::vector<double> & gantryAngles,
+                                                          const std::vector<double> & projOffsetsX,
+                                                          const std::vector<double> & projOffsetsY,
+                                                          const std::vector<double> & outOfPlaneAngles,
+                                                          const std::vector<double> & inPlaneAngles,
+                                                          const std::vector<double> & sourceOffsetsX,
+                                                          const std::vector<double> & sourceOffsetsY)
+{
+  const size_t n = gantryAngles.size();
+  const auto   checkSize = [n](const std::vector<double> & v, const char * name, bool optional) {
+    if (v.size() != n && v.size() != 1 && !(optional && v.empty()))
+      itkGenericExceptionMacro(<< "AddProjectionsInRadians: " << name << " has " << v.size() << " values for " << n
+                               << " gantry angles");
+  };
+  checkSize(sids, "sids", false);
+  checkSize(sdds, "sdds", false);
+  checkSize(projOffsetsX, "projOffsetsX", true);
+  checkSize(projOffsetsY, "projOffsetsY", true);
+  checkSize(outOfPlaneAngles, "outOfPlaneAngles", true);
+  checkSize(inPlaneAngles, "inPlaneAngles", true);
+  checkSize(sourceOffsetsX, "sourceOffsetsX", true);
+  checkSize(sourceOffsetsY, "sourceOffsetsY", true);
+
+  // Value of projection i, broadcasting single values and defaulting to 0
+  const auto value = [](const std::vector<double> & v, size_t i) {
+    return v.empty() ? 0. : v[v.size() == 1 ? 0 : i];
+  };
+  if (n == 0)
+    return;
+  const bool parallel = (value(sdds, 0) == 0.);
+  for (size_t i = 1; i < n; i++)
+    if ((value(sdds, i) == 0.) != parallel)
+      itkGenericExceptionMacro(<< "Cannot mix parallel and divergent projections in a 3D geometry object");
+  this->CheckParallelOrDivergent(value(sdds, 0));
+
+  // The matrices are computed in parallel and appended sequentially
+  std::vector<ProjectionMatrices> matrices(n);
+  itk::MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    n,
+    [&](itk::SizeValueType i) {
+      matrices[i] = ComputeProjectionMatrices(value(sids, i),
+                                              value(sdds, i),
+                                              gantryAngles[i],
+                                              value(projOffsetsX, i),
+                                              value(projOffsetsY, i),
+                                              value(outOfPlaneAngles, i),
+                                              value(inPlaneAngles, i),
+                                              value(sourceOffsetsX, i),
+                                              value(sourceOffsetsY, i));
+    },
+    nullptr);
+  for (size_t i = 0; i < n; i++)
+    this->AppendProjection(value(sids, i),
+                           value(sdds, i),
+                           gantryAngles[i],
+                           value(projOffsetsX, i),
+                           value(projOffsetsY, i),
+                           value(outOfPlaneAngles, i),
+                           value(inPlaneAngles, i),
+                           value(sourceOffsetsX, i),
+                           value(sourceOffsetsY, i),
+                           matrices[i]);
+}
+
+bool
+ThreeDCircularProjectionGeometry::AddProjections(const std::vector<double> & matrices)
+{
+  if (matrices.size() % 12)
+    itkGenericExceptionMacro(<< "AddProjections: " << matrices.size() << " values is not a multiple of 12");
+
+  bool                            allAdded = true;
+  HomogeneousProjectionMatrixType pMat;
+  for (size_t k = 0; k < matrices.size(); k += 12)
+  {
+    for (unsigned int i = 0; i < 3; i++)
+      for (unsigned int j = 0; j < 4; j++)
+        pMat[i][j] = matrices[k + 4 * i + j];
+    allAdded = this->AddProjection(pMat) && allAdded;
+  }
+  return allAdded;
+}
+
 void
 ThreeDCircularProjectionGeometry::Clear()
 {
@@ -593,6 +761,22 @@ ThreeDCircularProjectionGeometry::SetCollimationOfLastProjection(const double ui
   m_CollimationVSup.back() = vsup;
 }
 
+void
+ThreeDCircularProjectionGeometry::SetCollimations(const std::vector<double> & uinf,
+                                                  const std::vector<double> & usup,
+                                                  const std::vector<double> & vinf,
+                                                  const std::vector<double> & vsup)
+{
+  const size_t n = m_GantryAngles.size();
+  if (uinf.size() != n || usup.size() != n || vinf.size() != n || vsup.size() != n)
+    itkGenericExceptionMacro(<< "SetCollimations: one value per projection is required");
+  m_CollimationUInf = uinf;
+  m_CollimationUSup = usup;
+  m_CollimationVInf = vinf;
+  m_CollimationVSup = vsup;
+  this->Modified();
+}
+
 ThreeDCircularProjectionGeometry::HomogeneousVectorType
 ThreeDCircularProjectionGeometry::GetSourcePosition(const unsigned int i) const
 {
@@ -769,22 +953,19 @@ ThreeDCircularProjectionGeometry::InternalClone() const
 {
   LightObject::Pointer loPtr = Superclass::InternalClone();
   Self::Pointer        clone = dynamic_cast<Self *>(loPtr.GetPointer());
-  for (unsigned int iProj = 0; iProj < this->GetGantryAngles().size(); iProj++)
-  {
-    clone->AddProjectionInRadians(this->GetSourceToIsocenterDistances()[iProj],
-                                  this->GetSourceToDetectorDistances()[iProj],
-                                  this->GetGantryAngles()[iProj],
-                                  this->GetProjectionOffsetsX()[iProj],
-                                  this->GetProjectionOffsetsY()[iProj],
-                                  this->GetOutOfPlaneAngles()[iProj],
-                                  this->GetInPlaneAngles()[iProj],
-                                  this->GetSourceOffsetsX()[iProj],
-                                  this->GetSourceOffsetsY()[iProj]);
-    clone->SetCollimationOfLastProjection(this->GetCollimationUInf()[iProj],
-                                          this->GetCollimationUSup()[iProj],
-                                          this->GetCollimationVInf()[iProj],
-                                          this->GetCollimationVSup()[iProj]);
-  }
+  clone->AddProjectionsInRadians(this->GetSourceToIsocenterDistances(),
+                                 this->GetSourceToDetectorDistances(),
+                                 this->GetGantryAngles(),
+                                 this->GetProjectionOffsetsX(),
+                                 this->GetProjectionOffsetsY(),
+                                 this->GetOutOfPlaneAngles(),
+                                 this->GetInPlaneAngles(),
+                                 this->GetSourceOffsetsX(),
+                                 this->GetSourceOffsetsY());
+  clone->SetCollimations(this->GetCollimationUInf(),
+                         this->GetCollimationUSup(),
+                         this->GetCollimationVInf(),
+                         this->GetCollimationVSup());
   clone->SetRadiusCylindricalDetector(this->GetRadiusCylindricalDetector());
   return loPtr;
 }
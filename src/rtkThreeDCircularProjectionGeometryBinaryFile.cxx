@@ -0,0 +1,131 @@
+/*=========================================================================
+ *
+ *  Copyright RTK Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "rtkThreeDCircularProjectionGeometryBinaryFile.h"
+
+#include <itkByteSwapper.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace rtk
+{
+
+namespace
+{
+constexpr char         Signature[8] = { 'R', 'T', 'K', 'G', 'E', 'O', 'M', '\0' };
+constexpr uint32_t     BinaryVersion = 1;
+constexpr unsigned int NumberOfArrays = 13;
+
+template <class T>
+void
+WriteLittleEndian(std::ofstream & output, std::vector<T> values)
+{
+  itk::ByteSwapper<T>::SwapRangeFromSystemToLittleEndian(values.data(), values.size());
+  output.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+template <class T>
+std::vector<T>
+ReadLittleEndian(std::ifstream & input, size_t n, const std::string & filename)
+{
+  std::vector<T> values(n);
+  input.read(reinterpret_cast<char *>(values.data()), n * sizeof(T));
+  if (!input)
+    itkGenericExceptionMacro(<< "Unexpected end of binary geometry file " << filename);
+  itk::ByteSwapper<T>::SwapRangeFromLittleEndianToSystem(values.data(), values.size());
+  return values;
+}
+} // namespace
+
+void
+WriteGeometryBinary(const ThreeDCircularProjectionGeometry * geometry, const std::string & filename)
+{
+  if (geometry->GetGantryAngles().empty())
+    itkGenericExceptionMacro(<< "Geometry object is empty, cannot write it");
+
+  std::ofstream output(filename.c_str(), std::ios::binary);
+  if (!output)
+    itkGenericExceptionMacro(<< "Could not open " << filename << " for writing");
+
+  output.write(Signature, sizeof(Signature));
+  WriteLittleEndian(output, std::vector<uint32_t>{ BinaryVersion, uint32_t(geometry->GetGantryAngles().size()) });
+  WriteLittleEndian(output, std::vector<double>{ geometry->GetRadiusCylindricalDetector() });
+
+  const std::vector<double> * arrays[NumberOfArrays] = { &geometry->GetGantryAngles(),
+                                                         &geometry->GetOutOfPlaneAngles(),
+                                                         &geometry->GetInPlaneAngles(),
+                                                         &geometry->GetSourceToIsocenterDistances(),
+                                                         &geometry->GetSourceOffsetsX(),
+                                                         &geometry->GetSourceOffsetsY(),
+                                                         &geometry->GetSourceToDetectorDistances(),
+                                                         &geometry->GetProjectionOffsetsX(),
+                                                         &geometry->GetProjectionOffsetsY(),
+                                                         &geometry->GetCollimationUInf(),
+                                                         &geometry->GetCollimationUSup(),
+                                                         &geometry->GetCollimationVInf(),
+                                                         &geometry->GetCollimationVSup() };
+  for (const std::vector<double> * a : arrays)
+    WriteLittleEndian(output, *a);
+
+  if (!output)
+    itkGenericExceptionMacro(<< "Error while writing binary geometry file " << filename);
+}
+
+ThreeDCircularProjectionGeometry::Pointer
+ReadGeometryBinary(const std::string & filename)
+{
+  std::ifstream input(filename.c_str(), std::ios::binary);
+  if (!input)
+    itkGenericExceptionMacro(<< "Could not open " << filename << " for reading");
+
+  char signature[sizeof(Signature)];
+  input.read(signature, sizeof(signature));
+  if (!input || std::memcmp(signature, Signature, sizeof(Signature)))
+    itkGenericExceptionMacro(<< filename << " is not a binary geometry file");
+
+  const std::vector<uint32_t> header = ReadLittleEndian<uint32_t>(input, 2, filename);
+  if (header[0] > BinaryVersion)
+    itkGenericExceptionMacro(<< "Binary geometry file " << filename << " has version " << header[0]
+                             << " which is not supported by this version of RTK (" << BinaryVersion << ")");
+  const size_t n = header[1];
+  const double radius = ReadLittleEndian<double>(input, 1, filename)[0];
+
+  std::vector<double> arrays[NumberOfArrays];
+  for (std::vector<double> & a : arrays)
+    a = ReadLittleEndian<double>(input, n, filename);
+
+  auto geometry = ThreeDCircularProjectionGeometry::New();
+  geometry->AddProjectionsInRadians(
+    arrays[3], arrays[6], arrays[0], arrays[7], arrays[8], arrays[1], arrays[2], arrays[4], arrays[5]);
+  geometry->SetCollimations(arrays[9], arrays[10], arrays[11], arrays[12]);
+  geometry->SetRadiusCylindricalDetector(radius);
+  return geometry;
+}
+
+bool
+IsGeometryBinaryFile(const std::string & filename)
+{
+  std::ifstream input(filename.c_str(), std::ios::binary);
+  char          signature[sizeof(Signature)];
+  input.read(signature, sizeof(signature));
+  return input && !std::memcmp(signature, Signature, sizeof(Signature));
+}
+
+} // namespace rtk
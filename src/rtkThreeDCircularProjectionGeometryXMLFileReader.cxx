@@ -20,6 +20,7 @@
 #define _rtkThreeDCircularProjectionGeometryXMLFileReader_cxx
 
 #include "rtkThreeDCircularProjectionGeometryXMLFileReader.h"
+#include "rtkThreeDCircularProjectionGeometryBinaryFile.h"
 
 #include <itkIOCommon.h>
 #include <itkMetaDataObject.h>
@@ -175,6 +176,9 @@ ThreeDCircularProjectionGeometryXMLFileReader::CharacterDataHandler(const char *
 ThreeDCircularProjectionGeometry::Pointer
 ReadGeometry(const std::string & filename)
 {
+  if (IsGeometryBinaryFile(filename))
+    return ReadGeometryBinary(filename);
+
   const auto reader = ThreeDCircularProjectionGeometryXMLFileReader::New();
   reader->SetFilename(filename);
   reader->GenerateOutputInformation();
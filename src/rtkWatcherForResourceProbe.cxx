@@ -45,11 +45,13 @@ void
 WatcherForResourceProbe ::StartFilter()
 {
   GlobalResourceProbe::GetInstance()->Start(m_Process->GetNameOfClass());
+  GlobalResourceProbe::GetInstance()->TraceBegin(m_Process->GetNameOfClass(), "filter", m_Process);
 }
 
 void
 WatcherForResourceProbe ::EndFilter()
 {
+  GlobalResourceProbe::GetInstance()->TraceEnd(m_Process->GetNameOfClass(), "filter", m_Process);
   GlobalResourceProbe::GetInstance()->Stop(m_Process->GetNameOfClass());
 }
 
@@ -0,0 +1,44 @@
+import itk
+from itk import RTK as rtk
+import numpy as np
+
+
+def _matrices(geometry):
+    return np.array(
+        [itk.array_from_matrix(geometry.GetMatrix(i)) for i in range(len(geometry.GetGantryAngles()))]
+    )
+
+
+# Test for rtk.geometry_from_arrays against AddProjection
+def test_geometry_from_arrays():
+    angles = np.linspace(0.0, 360.0, 36, endpoint=False)
+    offsets_x = np.linspace(-10.0, 10.0, angles.size)
+    reference = rtk.ThreeDCircularProjectionGeometry.New()
+    for angle, offset_x in zip(angles, offsets_x):
+        reference.AddProjection(1000.0, 1500.0, angle, offset_x, 5.0, 2.0, 1.0)
+
+    geometry = rtk.geometry_from_arrays(1000.0, 1500.0, angles, offsets_x, 5.0, 2.0, 1.0)
+    assert np.allclose(geometry.GetGantryAngles(), reference.GetGantryAngles())
+    assert np.allclose(geometry.GetProjectionOffsetsX(), reference.GetProjectionOffsetsX())
+    assert np.allclose(_matrices(geometry), _matrices(reference))
+
+
+# Test for rtk.geometry_from_matrices on the matrices of a geometry
+def test_geometry_from_matrices():
+    reference = rtk.geometry_from_arrays(1000.0, 1500.0, np.arange(0.0, 360.0, 10.0), 3.0, -2.0, 5.0, 4.0)
+    geometry = rtk.geometry_from_matrices(_matrices(reference))
+    assert np.allclose(_matrices(geometry), _matrices(reference), atol=1e-6)
+
+
+# Test that NumPy views of RTK images share their buffer
+def test_image_array_view():
+    source = rtk.ConstantImageSource[itk.Image[itk.F, 3]].New()
+    source.SetSize([8, 8, 4])
+    source.SetConstant(1.0)
+    source.Update()
+    image = source.GetOutput()
+    view = itk.array_view_from_image(image)
+    view[0, 0, 0] = 2.0
+    assert image.GetPixel([0, 0, 0]) == 2.0
+    image_view = itk.image_view_from_array(view)
+    assert np.shares_memory(itk.array_view_from_image(image_view), view)
@@ -1,4 +1,5 @@
 #include <itkConfigure.h>
+#include <itkExtractImageFilter.h>
 #include <itkImageFileReader.h>
 #include <itkPasteImageFilter.h>
 
@@ -10,6 +11,7 @@
 #include "rtkMacro.h"
 #include "rtkRayEllipsoidIntersectionImageFilter.h"
 #include "rtkReg1DExtractShroudSignalImageFilter.h"
+#include "rtkStreamingAmsterdamShroud.h"
 #include "rtkTest.h"
 #include "rtkThreeDCircularProjectionGeometryXMLFile.h"
 
@@ -22,7 +24,8 @@
  * and extracts the breathing signal using two different methods, reg1D and D
  * algorithms. The generated results are compared to the expected results,
  * read from a baseline image in the MetaIO file format and hard-coded,
- * respectively.
+ * respectively. The shroud and the DP signal are also computed one projection
+ * at a time and compared to the results of the filters.
  *
  * \author Marc Vila
  */
@@ -272,6 +275,50 @@ rtkamsterdamshroudtest(int argc, char * argv[])
     exit(EXIT_FAILURE);
   }
 
+  std::cout << "\n\n****** Case 4: Streaming Amsterdam shroud and DP signal ******\n" << std::endl;
+
+  // Feed the projections one by one and compare to case 1
+  auto streamingShroud = rtk::StreamingAmsterdamShroud<OutputImageType>::New();
+  streamingShroud->SetAmplitude(20.);
+  auto extract = itk::ExtractImageFilter<OutputImageType, OutputImageType>::New();
+  extract->SetInput(pasteFilter->GetOutput());
+  extract->SetDirectionCollapseToSubmatrix();
+  OutputImageType::RegionType projRegion = pasteFilter->GetOutput()->GetLargestPossibleRegion();
+  projRegion.SetSize(2, 1);
+  for (unsigned int k = 0; k < NumberOfProjectionImages; k++)
+  {
+    projRegion.SetIndex(2, k);
+    extract->SetExtractionRegion(projRegion);
+    TRY_AND_EXIT_ON_ITK_EXCEPTION(extract->UpdateLargestPossibleRegion());
+    TRY_AND_EXIT_ON_ITK_EXCEPTION(streamingShroud->AddProjection(extract->GetOutput()));
+  }
+  CheckImageQuality<ShroudFilterType::OutputImageType>(
+    streamingShroud->GetShroud(), shroudFilter->GetOutput(), 1.20e-6, 185, 2.0);
+
+  // The incremental dynamic program must give the same signal as the filter
+  auto streamingDPFilter = rtk::DPExtractShroudSignalImageFilter<reg1DPixelType, reg1DPixelType>::New();
+  streamingDPFilter->SetInput(streamingShroud->GetShroud());
+  streamingDPFilter->SetAmplitude(20.);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(streamingDPFilter->Update());
+  reg1DImageType::Pointer                       streamingSignal = streamingShroud->GetSignal();
+  reg1DImageType::Pointer                       streamingDPSignal = streamingDPFilter->GetOutput();
+  itk::ImageRegionConstIterator<reg1DImageType> itStreaming(streamingSignal,
+                                                            streamingSignal->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<reg1DImageType> itStreamingDP(streamingDPSignal,
+                                                              streamingDPSignal->GetLargestPossibleRegion());
+  for (sum = 0.; !itStreaming.IsAtEnd(); ++itStreaming, ++itStreamingDP)
+    sum += std::abs(itStreamingDP.Get() - itStreaming.Get());
+
+  if (sum <= zeroValue)
+    std::cout << "Test PASSED! " << std::endl;
+  else
+  {
+    std::cerr << "Test FAILED! "
+              << "Streaming breathing signal does not match, absolute difference " << sum << " instead of 0."
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
 #if defined(USE_FFTWD)
   std::cout << "\n\n****** Extract phase from case 3 ******\n" << std::endl;
 
@@ -168,6 +168,17 @@ rtkconjugategradienttest(int, char *[])
 
   CheckImageQuality<OutputImageType, OutputImageType>(cg->GetOutput(), randomVolumeSource->GetOutput());
 
+  std::cout << "\n\n****** Stopping on the residual tolerance ******" << std::endl;
+
+  // Allow more iterations but stop as soon as the residual norm has been
+  // reduced by the tolerance factor
+  cg->SetNumberOfIterations(100);
+  cg->SetTolerance(1e-5);
+
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(cg->Update());
+
+  CheckImageQuality<OutputImageType, OutputImageType>(cg->GetOutput(), randomVolumeSource->GetOutput());
+
   std::cout << "\n\nTest PASSED! " << std::endl;
 
   return EXIT_SUCCESS;
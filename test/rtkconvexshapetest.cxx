@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <itkMath.h>
+
+#include "rtkBoxShape.h"
+#include "rtkQuadricShape.h"
+#include "rtkTest.h"
+
+/**
+ * \file rtkconvexshapetest.cxx
+ *
+ * \brief Test the batch functions of convex shapes
+ *
+ * This test checks that AreInside and AreIntersectedByRays give the same
+ * results as IsInside and IsIntersectedByRay called for each point and ray
+ * on a few boxes and quadrics, with and without clip planes, and random
+ * points and rays.
+ */
+
+namespace
+{
+using ShapeType = rtk::ConvexShape;
+using ScalarType = ShapeType::ScalarType;
+using PointType = ShapeType::PointType;
+using VectorType = ShapeType::VectorType;
+
+// The distances are compared with a tolerance to allow for a different
+// contraction of the floating point operations in the vectorized loops
+bool
+AreSameDistances(ScalarType a, ScalarType b)
+{
+  return a == b || std::abs(a - b) <= 1e-9 * std::max({ 1., std::abs(a), std::abs(b) });
+}
+
+bool
+CheckShape(const ShapeType *               shape,
+           const std::string &             name,
+           const std::vector<PointType> &  points,
+           const std::vector<PointType> &  rayOrigins,
+           const std::vector<VectorType> & rayDirections)
+{
+  const auto        nPoints = static_cast<unsigned int>(points.size());
+  auto              inside = std::make_unique<bool[]>(nPoints);
+  shape->AreInside(points.data(), nPoints, inside.get());
+  unsigned int nInside = 0;
+  for (unsigned int k = 0; k < nPoints; k++)
+  {
+    if (inside[k] != shape->IsInside(points[k]))
+    {
+      std::cerr << "Test Failed, " << name << ": AreInside and IsInside differ for point " << points[k] << std::endl;
+      return false;
+    }
+    nInside += inside[k];
+  }
+
+  const auto              nRays = static_cast<unsigned int>(rayOrigins.size());
+  std::vector<ScalarType> infDist(nRays), supDist(nRays);
+  auto                    intersected = std::make_unique<bool[]>(nRays);
+  shape->AreIntersectedByRays(rayOrigins.data(),
+                              rayDirections.data(),
+                              nRays,
+                              infDist.data(),
+                              supDist.data(),
+                              intersected.get());
+  unsigned int nIntersected = 0;
+  for (unsigned int k = 0; k < nRays; k++)
+  {
+    ScalarType inf = NAN, sup = NAN;
+    const bool hit = shape->IsIntersectedByRay(rayOrigins[k], rayDirections[k], inf, sup);
+    if (intersected[k] != hit)
+    {
+      std::cerr << "Test Failed, " << name << ": AreIntersectedByRays and IsIntersectedByRay differ for ray "
+                << rayOrigins[k] << " + t * " << rayDirections[k] << std::endl;
+      return false;
+    }
+    if (hit && (!AreSameDistances(infDist[k], inf) || !AreSameDistances(supDist[k], sup)))
+    {
+      std::cerr << "Test Failed, " << name << ": distances [" << infDist[k] << ", " << supDist[k] << "] instead of ["
+                << inf << ", " << sup << "] for ray " << rayOrigins[k] << " + t * " << rayDirections[k] << std::endl;
+      return false;
+    }
+    nIntersected += hit;
+  }
+
+  // Make sure that the test is not trivial
+  if (nInside == 0 || nInside == nPoints || nIntersected == 0 || nIntersected == nRays)
+  {
+    std::cerr << "Test Failed, " << name << ": " << nInside << " points inside and " << nIntersected
+              << " rays intersecting, the test is not relevant." << std::endl;
+    return false;
+  }
+  std::cout << name << ": " << nInside << '/' << nPoints << " points inside and " << nIntersected << '/' << nRays
+            << " rays intersecting." << std::endl;
+  return true;
+}
+} // namespace
+
+int
+rtkconvexshapetest(int, char *[])
+{
+  // Random points and rays. One ray out of four is parallel to an axis to
+  // test the zero direction components, e.g., of the box slabs.
+  std::mt19937                               generator(0);
+  std::uniform_real_distribution<ScalarType> position(-150., 150.);
+  std::uniform_real_distribution<ScalarType> direction(-1., 1.);
+  constexpr unsigned int                     n = 1000;
+  std::vector<PointType>                     points(n), rayOrigins(n);
+  std::vector<VectorType>                    rayDirections(n);
+  for (unsigned int k = 0; k < n; k++)
+  {
+    for (unsigned int i = 0; i < ShapeType::Dimension; i++)
+    {
+      points[k][i] = position(generator);
+      rayOrigins[k][i] = 2. * position(generator);
+      rayDirections[k][i] = direction(generator);
+    }
+    if (k % 4 == 0)
+    {
+      rayDirections[k].Fill(0.);
+      rayDirections[k][(k / 4) % ShapeType::Dimension] = (k % 8 == 0) ? 1. : -1.;
+    }
+    rayDirections[k].Normalize();
+  }
+
+  // Rotation of 30 degrees around y for the rotated shapes
+  const ScalarType              angle = 30. * itk::Math::pi / 180.;
+  ShapeType::RotationMatrixType rotation;
+  rotation.SetIdentity();
+  rotation[0][0] = rotation[2][2] = std::cos(angle);
+  rotation[0][2] = std::sin(angle);
+  rotation[2][0] = -std::sin(angle);
+
+  // Boxes
+  auto box = rtk::BoxShape::New();
+  box->SetBoxMin(itk::MakePoint(-80., -40., -60.));
+  box->SetBoxMax(itk::MakePoint(70., 50., 20.));
+  if (!CheckShape(box, "box", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+  box->Rotate(rotation);
+  box->AddClipPlane(itk::MakeVector(0., 1., 0.), 30.);
+  if (!CheckShape(box, "rotated and clipped box", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+
+  // Ellipsoids
+  auto ellipsoid = rtk::QuadricShape::New();
+  ellipsoid->SetEllipsoid(itk::MakePoint(10., -5., 3.), itk::MakeVector(90., 60., 40.), 20.);
+  if (!CheckShape(ellipsoid, "ellipsoid", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+  ellipsoid->AddClipPlane(itk::MakeVector(1., 0., 0.), 20.);
+  ellipsoid->AddClipPlane(itk::MakeVector(0., 0., -1.), 10.);
+  if (!CheckShape(ellipsoid, "clipped ellipsoid", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+
+  // Cylinder along y, infinite then clipped
+  auto cylinder = rtk::QuadricShape::New();
+  cylinder->SetA(1.);
+  cylinder->SetC(1.);
+  cylinder->SetJ(-50. * 50.);
+  if (!CheckShape(cylinder, "cylinder", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+  cylinder->Rotate(rotation);
+  cylinder->AddClipPlane(itk::MakeVector(0., 1., 0.), 80.);
+  cylinder->AddClipPlane(itk::MakeVector(0., -1., 0.), 80.);
+  if (!CheckShape(cylinder, "rotated and clipped cylinder", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+
+  // Hyperboloid of one sheet and half space for the rays which are handled by
+  // the fallback of the batch function, i.e., half lines and a zero quadratic
+  // coefficient.
+  auto hyperboloid = rtk::QuadricShape::New();
+  hyperboloid->SetA(1.);
+  hyperboloid->SetB(1.);
+  hyperboloid->SetC(-1.);
+  hyperboloid->SetJ(-40. * 40.);
+  if (!CheckShape(hyperboloid, "hyperboloid", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+  auto halfSpace = rtk::QuadricShape::New();
+  halfSpace->SetG(1.);
+  halfSpace->SetJ(-10.);
+  if (!CheckShape(halfSpace, "half space", points, rayOrigins, rayDirections))
+    return EXIT_FAILURE;
+
+  std::cout << "Test PASSED! " << std::endl;
+  return EXIT_SUCCESS;
+}
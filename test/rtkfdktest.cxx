@@ -1,3 +1,4 @@
+#include <itkImageDuplicator.h>
 #include <itkImageRegionConstIterator.h>
 #include <itkImageRegionSplitterDirection.h>
 #include <itkStreamingImageFilter.h>
@@ -59,6 +60,8 @@ rtkfdktest(int, char *[])
   tomographySource->SetSpacing(spacing);
   tomographySource->SetSize(size);
   tomographySource->SetConstant(0.);
+  const auto volumeOrigin = origin;
+  const auto volumeSize = size;
 
   origin = itk::MakePoint(-254., -254., -254.);
 #if FAST_TESTS_NO_CHECKS
@@ -180,5 +183,55 @@ rtkfdktest(int, char *[])
   TRY_AND_EXIT_ON_ITK_EXCEPTION(dsl->UpdateLargestPossibleRegion())
   CheckImageQuality<OutputImageType>(fov->GetOutput(), dsl->GetOutput(), 0.03, 26, 2.0);
   std::cout << "Test PASSED! " << std::endl;
+
+#ifndef USE_CUDA
+  std::cout << "\n\n****** Case 6: single precision coordinates ******" << std::endl;
+
+  // Full volume with identity direction so that the backprojection of the
+  // projections at 0 and 180 degrees uses the optimized loops along x. The
+  // other projections, including those at 90 and 270 degrees for which the
+  // depth varies along x, are backprojected by the generic loop in both
+  // cases, so this case only covers these two views.
+  direction.SetIdentity();
+  tomographySource->SetDirection(direction);
+  tomographySource->SetOrigin(volumeOrigin);
+  tomographySource->SetSize(volumeSize);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(dsl->UpdateLargestPossibleRegion())
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(fov->UpdateLargestPossibleRegion());
+
+  // Reconstruction with double precision coordinates
+  auto duplicator = itk::ImageDuplicator<OutputImageType>::New();
+  duplicator->SetInputImage(fov->GetOutput());
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(duplicator->Update());
+
+  // The backprojection filter is internal to the FDK filter which must be
+  // modified to be updated again
+  feldkamp->GetBackProjectionFilter()->SinglePrecisionCoordinatesOn();
+  feldkamp->Modified();
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(fov->UpdateLargestPossibleRegion());
+  CheckImageQuality<OutputImageType>(fov->GetOutput(), dsl->GetOutput(), 0.03, 26, 2.0);
+  CheckImageQuality<OutputImageType>(fov->GetOutput(), duplicator->GetOutput(), 1e-4, 70, 2.0);
+
+  // Largest difference with the double precision reconstruction
+  itk::ImageRegionConstIterator<OutputImageType> itSingle(fov->GetOutput(), fov->GetOutput()->GetBufferedRegion());
+  itk::ImageRegionConstIterator<OutputImageType> itDouble(duplicator->GetOutput(),
+                                                          duplicator->GetOutput()->GetBufferedRegion());
+  double                                         maxDiff = 0.;
+  for (; !itSingle.IsAtEnd(); ++itSingle, ++itDouble)
+    maxDiff = std::max(maxDiff, (double)std::abs(itSingle.Get() - itDouble.Get()));
+  std::cout << "Maximum difference with double precision = " << maxDiff << std::endl;
+  if (maxDiff > 1e-3)
+  {
+    std::cerr << "Test Failed, maximum difference with double precision " << maxDiff << " instead of 1e-3"
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  if (maxDiff == 0.)
+  {
+    std::cerr << "Test Failed, the single precision backprojection has not been used" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << "Test PASSED! " << std::endl;
+#endif
   return EXIT_SUCCESS;
 }
@@ -206,5 +206,18 @@ rtkforwardprojectiontest(int, char *[])
   CheckImageQuality<OutputImageType>(stream->GetOutput(), slp->GetOutput(), 1.28, 44, 255.0);
   std::cout << "\n\nTest PASSED! " << std::endl;
 
+#ifndef USE_CUDA
+  std::cout << "\n\n****** Case 6: Shepp-Logan, inner ray source, ray table ******" << std::endl;
+  jfp->SetRayTable(rtk::JosephRayTable::New());
+  stream->Update();
+  CheckImageQuality<OutputImageType>(stream->GetOutput(), slp->GetOutput(), 1.28, 44, 255.0);
+
+  // Second projection with the rays of the table
+  jfp->Modified();
+  stream->Update();
+  CheckImageQuality<OutputImageType>(stream->GetOutput(), slp->GetOutput(), 1.28, 44, 255.0);
+  std::cout << "\n\nTest PASSED! " << std::endl;
+#endif
+
   return EXIT_SUCCESS;
 }
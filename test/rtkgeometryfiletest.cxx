@@ -1,29 +1,20 @@
 #include "rtkTestConfiguration.h"
 #include "rtkMacro.h"
+#include "rtkThreeDCircularProjectionGeometryBinaryFile.h"
 #include "rtkThreeDCircularProjectionGeometryXMLFile.h"
 #include <itksys/SystemTools.hxx>
 
 using GeometryType = rtk::ThreeDCircularProjectionGeometry;
 
 void
-WriteReadAndCheck(GeometryType * geometry)
+CheckGeometries(const GeometryType * geoRead, const GeometryType * geometry, const double epsilon)
 {
-  const char   fileName[] = "rtkgeometryfiletest.out";
-  const double epsilon = 1e-13;
-
-  auto xmlWriter = rtk::ThreeDCircularProjectionGeometryXMLFileWriter::New();
-  xmlWriter->SetFilename(fileName);
-  xmlWriter->SetObject(geometry);
-  TRY_AND_EXIT_ON_ITK_EXCEPTION(xmlWriter->WriteFile())
-
-  rtk::ThreeDCircularProjectionGeometryXMLFileReader::Pointer xmlReader;
-  xmlReader = rtk::ThreeDCircularProjectionGeometryXMLFileReader::New();
-  xmlReader->SetFilename(fileName);
-  TRY_AND_EXIT_ON_ITK_EXCEPTION(xmlReader->GenerateOutputInformation())
-
-  itksys::SystemTools::RemoveFile(fileName);
-
-  GeometryType * geoRead = xmlReader->GetOutputObject();
+  if (geoRead->GetGantryAngles().size() != geometry->GetGantryAngles().size())
+  {
+    std::cerr << "Number of projections differ [" << geoRead->GetGantryAngles().size() << "] vs. ["
+              << geometry->GetGantryAngles().size() << "]." << std::endl;
+    exit(1);
+  }
   for (unsigned int i = 0; i < geometry->GetGantryAngles().size(); i++)
   {
 #define CHECK_GEOMETRY_PARAMETER(paramName)                                                   \
@@ -47,6 +38,58 @@ WriteReadAndCheck(GeometryType * geometry)
     CHECK_GEOMETRY_PARAMETER(SourceToDetectorDistances);
     CHECK_GEOMETRY_PARAMETER(ProjectionOffsetsX);
     CHECK_GEOMETRY_PARAMETER(ProjectionOffsetsY);
+    CHECK_GEOMETRY_PARAMETER(CollimationUInf);
+    CHECK_GEOMETRY_PARAMETER(CollimationVSup);
+
+    for (unsigned int j = 0; j < 3; j++)
+      for (unsigned int k = 0; k < 4; k++)
+        if (std::abs(geoRead->GetMatrices()[i][j][k] - geometry->GetMatrices()[i][j][k]) >
+            epsilon * (1. + std::abs(geometry->GetMatrices()[i][j][k])))
+        {
+          std::cerr << "Matrices of projection " << i << " differ:" << std::endl
+                    << geoRead->GetMatrices()[i] << "vs." << std::endl
+                    << geometry->GetMatrices()[i] << std::endl;
+          exit(1);
+        }
+  }
+}
+
+void
+WriteReadAndCheck(GeometryType * geometry)
+{
+  const char fileName[] = "rtkgeometryfiletest.out";
+
+  auto xmlWriter = rtk::ThreeDCircularProjectionGeometryXMLFileWriter::New();
+  xmlWriter->SetFilename(fileName);
+  xmlWriter->SetObject(geometry);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(xmlWriter->WriteFile())
+
+  rtk::ThreeDCircularProjectionGeometryXMLFileReader::Pointer xmlReader;
+  xmlReader = rtk::ThreeDCircularProjectionGeometryXMLFileReader::New();
+  xmlReader->SetFilename(fileName);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(xmlReader->GenerateOutputInformation())
+
+  itksys::SystemTools::RemoveFile(fileName);
+
+  CheckGeometries(xmlReader->GetOutputObject(), geometry, 1e-13);
+
+  // Binary format round trip, through the convenience functions which select
+  // the format from the file extension and the file signature
+  const std::string binaryFileName = std::string("rtkgeometryfiletest") + rtk::BinaryGeometryFileExtension;
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(rtk::WriteGeometry(geometry, binaryFileName))
+  if (!rtk::IsGeometryBinaryFile(binaryFileName))
+  {
+    std::cerr << "The binary geometry file has not been recognized." << std::endl;
+    exit(1);
+  }
+  GeometryType::Pointer geoBinary;
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(geoBinary = rtk::ReadGeometry(binaryFileName))
+  itksys::SystemTools::RemoveFile(binaryFileName);
+  CheckGeometries(geoBinary, geometry, 1e-13);
+  if (geoBinary->GetRadiusCylindricalDetector() != geometry->GetRadiusCylindricalDetector())
+  {
+    std::cerr << "RadiusCylindricalDetector differ after binary round trip." << std::endl;
+    exit(1);
   }
 }
 
@@ -84,6 +127,37 @@ rtkgeometryfiletest(int, char *[])
   geometry->AddProjection(578., 68., 9879., -38.4, 2158.4, -158.4, -43.3, 3218.4, 325.4);
   WriteReadAndCheck(geometry);
 
+  // Compare the bulk construction of a geometry to the projection by projection
+  // construction, with collimation and a cylindrical detector
+  std::cout << "\n\nTesting AddProjections..." << std::endl;
+  constexpr unsigned int nproj = 1000;
+  std::vector<double>    angles, offsetsX, outOfPlaneAngles, uinf, usup, vinf, vsup;
+  geometry = GeometryType::New();
+  geometry->SetRadiusCylindricalDetector(548.);
+  for (unsigned int i = 0; i < nproj; i++)
+  {
+    angles.push_back(i * 1.7 - 20.);
+    offsetsX.push_back(0.01 * i);
+    outOfPlaneAngles.push_back(i % 7 - 3.);
+    geometry->AddProjection(615., 548., angles.back(), offsetsX.back(), 1.57, outOfPlaneAngles.back(), 13.48);
+    uinf.push_back(10. + i);
+    usup.push_back(11.);
+    vinf.push_back(12.);
+    vsup.push_back(13. + i);
+    geometry->SetCollimationOfLastProjection(uinf.back(), usup.back(), vinf.back(), vsup.back());
+  }
+  auto bulkGeometry = GeometryType::New();
+  bulkGeometry->SetRadiusCylindricalDetector(548.);
+  bulkGeometry->AddProjections({ 615. }, { 548. }, angles, offsetsX, { 1.57 }, outOfPlaneAngles, { 13.48 });
+  bulkGeometry->SetCollimations(uinf, usup, vinf, vsup);
+  CheckGeometries(bulkGeometry, geometry, 0.);
+  WriteReadAndCheck(geometry);
+
+  // Clones use the bulk construction too
+  GeometryType::Pointer clone;
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(clone = geometry->Clone())
+  CheckGeometries(clone, geometry, 1e-13);
+
   std::cout << "\n\nTest PASSED! " << std::endl;
   return EXIT_SUCCESS;
 }
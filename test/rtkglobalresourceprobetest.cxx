@@ -0,0 +1,111 @@
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include "rtkConstantImageSource.h"
+#include "rtkDrawSheppLoganFilter.h"
+#include "rtkGlobalResourceProbe.h"
+#include "rtkTest.h"
+
+/**
+ * \file rtkglobalresourceprobetest.cxx
+ *
+ * \brief Test the trace of rtk::GlobalResourceProbe
+ *
+ * This test switches tracing on, updates a small pipeline of watched filters
+ * and checks that the trace written by WriteTrace contains matching begin and
+ * end events for each filter.
+ */
+
+namespace
+{
+// Value of a string field of a JSON event written on a single line
+std::string
+GetField(const std::string & line, const std::string & field)
+{
+  const std::string key = "\"" + field + "\":\"";
+  size_t            begin = line.find(key);
+  if (begin == std::string::npos)
+    return "";
+  begin += key.size();
+  return line.substr(begin, line.find('"', begin) - begin);
+}
+} // namespace
+
+int
+rtkglobalresourceprobetest(int, char *[])
+{
+  using OutputImageType = itk::Image<float, 3>;
+
+  auto probe = rtk::GlobalResourceProbe::GetInstance();
+  probe->TracingOn();
+
+  auto source = rtk::ConstantImageSource<OutputImageType>::New();
+  source->SetOrigin(itk::MakePoint(-127., -127., -127.));
+  source->SetSpacing(itk::MakeVector(8., 8., 8.));
+  source->SetSize(itk::MakeSize(32, 32, 32));
+  source->SetConstant(0.);
+
+  auto dsl = rtk::DrawSheppLoganFilter<OutputImageType, OutputImageType>::New();
+  dsl->SetInput(source->GetOutput());
+  dsl->SetPhantomScale(116);
+
+  probe->Watch(source);
+  probe->Watch(dsl);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(dsl->Update());
+  probe->TracingOff();
+
+  std::ostringstream trace;
+  probe->WriteTrace(trace);
+
+  // Check the begin and end events, which must be nested in each thread
+  const std::string text = trace.str();
+  if (text.rfind("{\"traceEvents\":[", 0) != 0 || text.find("\n],\"displayTimeUnit\":\"ms\"}") == std::string::npos)
+  {
+    std::cerr << "Test Failed, trace is not a JSON trace event object:" << std::endl << text << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::map<std::string, std::vector<std::string>> stacks;
+  std::map<std::string, unsigned int>             nbPairs;
+  std::istringstream                              lines(text);
+  std::string                                     line;
+  while (std::getline(lines, line))
+  {
+    const std::string phase = GetField(line, "ph");
+    if (phase != "B" && phase != "E")
+      continue;
+    const std::string tid = line.substr(line.find("\"tid\":"), line.find(",\"args\"") - line.find("\"tid\":"));
+    const std::string name = GetField(line, "name") + "/" + GetField(line, "object");
+    if (phase == "B")
+      stacks[tid].push_back(name);
+    else
+    {
+      if (stacks[tid].empty() || stacks[tid].back() != name)
+      {
+        std::cerr << "Test Failed, end event without matching begin event: " << line << std::endl;
+        return EXIT_FAILURE;
+      }
+      stacks[tid].pop_back();
+      nbPairs[GetField(line, "name")]++;
+    }
+  }
+  for (const auto & stack : stacks)
+  {
+    if (!stack.second.empty())
+    {
+      std::cerr << "Test Failed, begin event without end event: " << stack.second.back() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  for (const char * name : { "ConstantImageSource", "DrawSheppLoganFilter" })
+  {
+    if (nbPairs[name] == 0)
+    {
+      std::cerr << "Test Failed, no begin/end pair for " << name << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test PASSED! " << std::endl;
+  return EXIT_SUCCESS;
+}
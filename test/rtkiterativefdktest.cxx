@@ -22,8 +22,9 @@
  *
  * This test generates the projections of a simulated Shepp-Logan phantom.
  * A CT image is reconstructed from the set of generated projection images
- * using the iterative FDK algorithm and the reconstructed CT image is compared
- * to the expected results which is analytically computed.
+ * using the iterative FDK algorithm with each forward projector and the
+ * reconstructed CT image is compared to the expected results which is
+ * analytically computed.
  *
  * \author Simon Rit
  */
@@ -121,5 +122,36 @@ rtkiterativefdktest(int, char *[])
   CheckImageQuality<OutputImageType>(fov->GetOutput(), dsl->GetOutput(), 0.027, 27, 2.0);
   std::cout << "Test PASSED! " << std::endl;
 
+#ifndef USE_CUDA
+  std::cout << "\n\n****** Case 2: Joseph attenuated forward projector ******" << std::endl;
+
+  // A null attenuation map gives the same forward projection as Joseph
+  ifdk->SetAttenuationMap(tomographySource->GetOutput());
+  ifdk->SetForwardProjectionFilter(FDKType::FP_JOSEPHATTENUATED);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(fov->Update());
+
+  CheckImageQuality<OutputImageType>(fov->GetOutput(), dsl->GetOutput(), 0.027, 27, 2.0);
+  std::cout << "Test PASSED! " << std::endl;
+
+  std::cout << "\n\n****** Case 3: Zeng forward projector ******" << std::endl;
+
+  // Zeng is a parallel projector, used without PSF
+  auto parallelGeometry = rtk::ThreeDCircularProjectionGeometry::New();
+  for (unsigned int noProj = 0; noProj < NumberOfProjectionImages; noProj++)
+    parallelGeometry->AddProjection(600., 0., noProj * 360. / NumberOfProjectionImages);
+  slp->SetGeometry(parallelGeometry);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(slp->Update());
+
+  ifdk->SetGeometry(parallelGeometry);
+  ifdk->SetSigmaZero(0.);
+  ifdk->SetAlphaPSF(0.);
+  ifdk->SetForwardProjectionFilter(FDKType::FP_ZENG);
+  fov->SetGeometry(parallelGeometry);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(fov->Update());
+
+  CheckImageQuality<OutputImageType>(fov->GetOutput(), dsl->GetOutput(), 0.03, 26, 2.0);
+  std::cout << "Test PASSED! " << std::endl;
+#endif
+
   return EXIT_SUCCESS;
 }
@@ -1,3 +1,4 @@
+#include <itkImageDuplicator.h>
 #include <itkImageRegionConstIterator.h>
 
 #include "itkMaskImageFilter.h"
@@ -19,7 +20,9 @@
  * This test generates the projections of an ellipsoid and reconstructs the CT
  * image using the OSEM algorithm with different backprojectors (Voxel-Based,
  * Joseph and CUDA Voxel-Based). The generated results are compared to the
- * expected results (analytical calculation).
+ * expected results (analytical calculation). The Joseph reconstructions are
+ * also compared with and without the table of ray intersections shared by the
+ * projectors.
  *
  * \author Antoine Robert
  */
@@ -202,5 +205,37 @@ rtkosemtest(int, char *[])
 
   CheckImageQuality<OutputImageType>(osem->GetOutput(), dsl->GetOutput(), 0.032, 25.0, 2.0);
   std::cout << "\n\nTest PASSED! " << std::endl;
+
+#ifndef USE_CUDA
+  std::cout << "\n\n****** Case 6: Joseph Attenuated projectors with a shared ray table ******" << std::endl;
+
+  // Keep a copy of the reconstruction without ray table since the buffers of
+  // the output may be reused by the next update
+  auto withoutRayTable = itk::ImageDuplicator<OutputImageType>::New();
+  withoutRayTable->SetInputImage(osem->GetOutput());
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(withoutRayTable->Update());
+
+  osem->SetUseJosephRayTable(true);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(osem->Update());
+
+  CheckImageQuality<OutputImageType>(osem->GetOutput(), withoutRayTable->GetOutput(), 1e-4, 70.0, 2.0);
+  std::cout << "\n\nTest PASSED! " << std::endl;
+
+  std::cout << "\n\n****** Case 7: Joseph projectors with a shared ray table ******" << std::endl;
+
+  osem->SetUseJosephRayTable(false);
+  osem->SetBackProjectionFilter(OSEMType::BP_JOSEPH);
+  osem->SetForwardProjectionFilter(OSEMType::FP_JOSEPH);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(osem->Update());
+
+  withoutRayTable->SetInputImage(osem->GetOutput());
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(withoutRayTable->Update());
+
+  osem->SetUseJosephRayTable(true);
+  TRY_AND_EXIT_ON_ITK_EXCEPTION(osem->Update());
+
+  CheckImageQuality<OutputImageType>(osem->GetOutput(), withoutRayTable->GetOutput(), 1e-4, 70.0, 2.0);
+  std::cout << "\n\nTest PASSED! " << std::endl;
+#endif
   return EXIT_SUCCESS;
 }
@@ -3,6 +3,7 @@ from itk import RTK as rtk
 import importlib
 import shlex
 import math
+import numpy as np
 
 
 # Write a 3D circular projection geometry to a file.
@@ -27,6 +28,53 @@ def read_geometry(filename):
     return reader.GetOutputObject()
 
 
+def _as_double_list(values):
+    return np.asarray(values, dtype=np.float64).ravel().tolist()
+
+
+# Create a 3D circular projection geometry from arrays of parameters (angles in
+# degrees) with a single call to the C++ geometry. Each parameter is either an
+# array with one value per gantry angle or a scalar used for all projections.
+def geometry_from_arrays(
+    sid,
+    sdd,
+    gantry_angles,
+    proj_offset_x=0.0,
+    proj_offset_y=0.0,
+    out_of_plane_angles=0.0,
+    in_plane_angles=0.0,
+    source_offset_x=0.0,
+    source_offset_y=0.0,
+    radius_cylindrical_detector=0.0,
+):
+    geometry = rtk.ThreeDCircularProjectionGeometry.New()
+    geometry.SetRadiusCylindricalDetector(radius_cylindrical_detector)
+    geometry.AddProjections(
+        _as_double_list(sid),
+        _as_double_list(sdd),
+        _as_double_list(gantry_angles),
+        _as_double_list(proj_offset_x),
+        _as_double_list(proj_offset_y),
+        _as_double_list(out_of_plane_angles),
+        _as_double_list(in_plane_angles),
+        _as_double_list(source_offset_x),
+        _as_double_list(source_offset_y),
+    )
+    return geometry
+
+
+# Create a 3D circular projection geometry from an Nx3x4 array of projection
+# matrices with a single call to the C++ geometry.
+def geometry_from_matrices(matrices):
+    matrices = np.asarray(matrices, dtype=np.float64)
+    if matrices.shape[-2:] != (3, 4):
+        raise ValueError(f"Expected an array of 3x4 matrices, got shape {matrices.shape}")
+    geometry = rtk.ThreeDCircularProjectionGeometry.New()
+    if not geometry.AddProjections(_as_double_list(matrices)):
+        raise RuntimeError("Some projection matrices could not be converted")
+    return geometry
+
+
 # Read a signal file
 def read_signal_file(filename):
     signal_vector = []